@@ -0,0 +1,89 @@
+#include "AlmacenBases.h"
+#include <cstring>
+
+/**
+ * Desc: Constructor del almacén de bases LP.
+ *       Todas las bases tienen el mismo tamaño (una entrada por columna y fila del modelo),
+ *       así que se guardan por bloques y los espacios liberados se reutilizan.
+ * Params:
+ *   - tamanoBase: Bytes de cada base (columnas + filas del modelo).
+ *   - basesPorBloque: Bases que caben en cada bloque reservado.
+ * Returns: void
+ */
+AlmacenBases::AlmacenBases(size_t tamanoBase, size_t basesPorBloque)
+    : tamanoBase(tamanoBase), basesPorBloque(basesPorBloque), numBases(0) {}
+
+/**
+ * Desc: Copia una base al almacén.
+ * Params:
+ *   - base: Estado de columnas y filas a guardar (tamanoBase bytes).
+ * Returns:
+ *   - int: Índice con el que se recupera la base.
+ */
+int AlmacenBases::guardar(const unsigned char* base) {
+    unsigned char* destino;
+    int idx;
+    {
+        lock_guard<mutex> lock(mtx);
+        if (!libres.empty()) {
+            idx = libres.back();
+            libres.pop_back();
+        } else {
+            idx = numBases++;
+            if (idx / basesPorBloque >= bloques.size()) {
+                bloques.push_back(make_unique<unsigned char[]>(tamanoBase * basesPorBloque));
+            }
+        }
+        destino = bloques[idx / basesPorBloque].get() + tamanoBase * (idx % basesPorBloque);
+    }
+    memcpy(destino, base, tamanoBase);
+    return idx;
+}
+
+/**
+ * Desc: Devuelve la base guardada con el índice dado.
+ * Params:
+ *   - idx: Índice entregado por guardar().
+ * Returns:
+ *   - const unsigned char*: Estado de columnas y filas, o nullptr si idx es negativo.
+ */
+const unsigned char* AlmacenBases::obtener(int idx) const {
+    if (idx < 0) {
+        return nullptr;
+    }
+    lock_guard<mutex> lock(mtx);
+    return bloques[idx / basesPorBloque].get() + tamanoBase * (idx % basesPorBloque);
+}
+
+/**
+ * Desc: Libera el espacio de una base para reutilizarlo.
+ * Params:
+ *   - idx: Índice de la base (se ignora si es negativo).
+ * Returns: void
+ */
+void AlmacenBases::liberar(int idx) {
+    if (idx < 0) {
+        return;
+    }
+    lock_guard<mutex> lock(mtx);
+    libres.push_back(idx);
+}
+
+/**
+ * Desc: Devuelve el número de bases guardadas y aún no liberadas.
+ * Params: void
+ * Returns:
+ *   - size_t: Bases vivas.
+ */
+size_t AlmacenBases::basesVivas() const {
+    lock_guard<mutex> lock(mtx);
+    return numBases - libres.size();
+}
+
+/**
+ * Desc: Devuelve el tamaño en bytes de cada base.
+ * Params: void
+ * Returns:
+ *   - size_t: Bytes por base.
+ */
+size_t AlmacenBases::obtenerTamanoBase() const { return tamanoBase; }
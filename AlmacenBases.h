@@ -0,0 +1,30 @@
+#ifndef ALMACEN_BASES_H
+#define ALMACEN_BASES_H
+
+#include <vector>
+#include <memory>
+#include <mutex>
+
+using namespace std;
+
+class AlmacenBases {
+private:
+    size_t tamanoBase;
+    size_t basesPorBloque;
+    vector<unique_ptr<unsigned char[]>> bloques;
+    int numBases;
+    vector<int> libres;
+    mutable mutex mtx;
+
+public:
+    AlmacenBases(size_t tamanoBase, size_t basesPorBloque = 1024);
+
+    int guardar(const unsigned char* base);
+    const unsigned char* obtener(int idx) const;
+    void liberar(int idx);
+
+    size_t basesVivas() const;
+    size_t obtenerTamanoBase() const;
+};
+
+#endif // ALMACEN_BASES_H
@@ -0,0 +1,60 @@
+#include "ArchivoMapeado.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Desc: Proyecta el archivo completo en memoria, de solo lectura.
+ *       El descriptor se cierra de inmediato: el mapeo no lo necesita.
+ * Params:
+ *   - nombreArchivo: Ruta del archivo a proyectar.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si el archivo no se puede abrir, está vacío o falla mmap.
+ */
+ArchivoMapeado::ArchivoMapeado(const string& nombreArchivo) : datos(nullptr), tamano(0) {
+    int fd = open(nombreArchivo.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("No se pudo abrir el archivo: " + nombreArchivo);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        throw runtime_error("Archivo vacío o ilegible: " + nombreArchivo);
+    }
+    tamano = info.st_size;
+    void* mapeo = mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapeo == MAP_FAILED) {
+        throw runtime_error("No se pudo proyectar en memoria el archivo: " + nombreArchivo);
+    }
+    madvise(mapeo, tamano, MADV_WILLNEED);
+    datos = static_cast<const unsigned char*>(mapeo);
+}
+
+/**
+ * Desc: Libera el mapeo.
+ * Params: void
+ * Returns: void
+ */
+ArchivoMapeado::~ArchivoMapeado() {
+    munmap(const_cast<unsigned char*>(datos), tamano);
+}
+
+/**
+ * Desc: Devuelve el inicio del archivo proyectado.
+ * Params: void
+ * Returns:
+ *   - const unsigned char*: Primer byte del archivo.
+ */
+const unsigned char* ArchivoMapeado::obtenerDatos() const { return datos; }
+
+/**
+ * Desc: Devuelve el tamaño del archivo proyectado.
+ * Params: void
+ * Returns:
+ *   - size_t: Bytes del archivo.
+ */
+size_t ArchivoMapeado::obtenerTamano() const { return tamano; }
@@ -0,0 +1,27 @@
+#ifndef ARCHIVO_MAPEADO_H
+#define ARCHIVO_MAPEADO_H
+
+#include <string>
+#include <cstddef>
+
+using namespace std;
+
+// Archivo proyectado en memoria de solo lectura (mmap). El mapeo vive mientras
+// viva el objeto; Problema lo comparte para ver los datos del formato binario
+// en su lugar, sin copiarlos.
+class ArchivoMapeado {
+private:
+    const unsigned char* datos;
+    size_t tamano;
+
+public:
+    ArchivoMapeado(const string& nombreArchivo);
+    ~ArchivoMapeado();
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+    const unsigned char* obtenerDatos() const;
+    size_t obtenerTamano() const;
+};
+
+#endif // ARCHIVO_MAPEADO_H
@@ -0,0 +1,128 @@
+#include "ArenaNodos.h"
+#include <cstring>
+
+/**
+ * Desc: Constructor de la arena de nodos.
+ *       Todos los nodos tienen el mismo tamaño (cabecera más dos conjuntos de bits),
+ *       así que se reservan por bloques y los liberados se reutilizan.
+ * Params:
+ *   - numVariables: Número de variables y_j (fuentes de producción).
+ *   - nodosPorBloque: Nodos que caben en cada bloque reservado.
+ * Returns: void
+ */
+ArenaNodos::ArenaNodos(int numVariables, size_t nodosPorBloque)
+    : numPalabras((numVariables + 63) / 64), nodosPorBloque(nodosPorBloque), usadosUltimoBloque(nodosPorBloque), vivos(0) {
+    tamanoNodo = sizeof(NodoCompacto) / sizeof(uint64_t) + 2 * numPalabras;
+}
+
+/**
+ * Desc: Toma memoria para un nodo, primero de la lista de libres y si no del bloque actual.
+ *       Debe llamarse con el mutex tomado.
+ * Params: void
+ * Returns:
+ *   - NodoCompacto*: Memoria sin inicializar para un nodo.
+ */
+NodoCompacto* ArenaNodos::reservar() {
+    vivos++;
+    if (!libres.empty()) {
+        NodoCompacto* nodo = libres.back();
+        libres.pop_back();
+        return nodo;
+    }
+    if (usadosUltimoBloque == nodosPorBloque) {
+        bloques.push_back(make_unique<uint64_t[]>(tamanoNodo * nodosPorBloque));
+        usadosUltimoBloque = 0;
+    }
+    uint64_t* memoria = bloques.back().get() + tamanoNodo * usadosUltimoBloque++;
+    return reinterpret_cast<NodoCompacto*>(memoria);
+}
+
+/**
+ * Desc: Crea un nodo raíz sin variables fijadas.
+ * Params: void
+ * Returns:
+ *   - NodoCompacto*: Nodo creado.
+ */
+NodoCompacto* ArenaNodos::crear() {
+    NodoCompacto* nodo;
+    {
+        lock_guard<mutex> lock(mtx);
+        nodo = reservar();
+    }
+    nodo->cotaInferior = 0.0f;
+    nodo->estimacion = 0.0f;
+    nodo->profundidad = 0;
+    nodo->varRamificacion = -1;
+    nodo->valorRamificacion = 0.0f;
+    nodo->idxBase = -1;
+    nodo->numPalabras = numPalabras;
+    memset(nodo->fijadasCero(), 0, 2 * numPalabras * sizeof(uint64_t));
+    return nodo;
+}
+
+/**
+ * Desc: Crea un nodo hijo que hereda las variables fijadas y la cota del padre.
+ *       No copia la base: el hijo la obtiene al resolver su propia relajación.
+ * Params:
+ *   - padre: Nodo padre.
+ * Returns:
+ *   - NodoCompacto*: Nodo creado con profundidad del padre + 1.
+ */
+NodoCompacto* ArenaNodos::crearHijo(const NodoCompacto* padre) {
+    NodoCompacto* nodo;
+    {
+        lock_guard<mutex> lock(mtx);
+        nodo = reservar();
+    }
+    nodo->cotaInferior = padre->cotaInferior;
+    nodo->estimacion = padre->estimacion;
+    nodo->profundidad = padre->profundidad + 1;
+    nodo->varRamificacion = -1;
+    nodo->valorRamificacion = 0.0f;
+    nodo->idxBase = -1;
+    nodo->numPalabras = numPalabras;
+    memcpy(nodo->fijadasCero(), padre->fijadasCero(), 2 * numPalabras * sizeof(uint64_t));
+    return nodo;
+}
+
+/**
+ * Desc: Devuelve un nodo a la arena para reutilizar su memoria.
+ * Params:
+ *   - nodo: Nodo a liberar.
+ * Returns: void
+ */
+void ArenaNodos::liberar(NodoCompacto* nodo) {
+    lock_guard<mutex> lock(mtx);
+    libres.push_back(nodo);
+    vivos--;
+}
+
+/**
+ * Desc: Devuelve el número de nodos creados y aún no liberados.
+ * Params: void
+ * Returns:
+ *   - size_t: Nodos vivos.
+ */
+size_t ArenaNodos::nodosVivos() const {
+    lock_guard<mutex> lock(mtx);
+    return vivos;
+}
+
+/**
+ * Desc: Devuelve el tamaño en bytes que ocupa cada nodo en la arena.
+ * Params: void
+ * Returns:
+ *   - size_t: Bytes por nodo.
+ */
+size_t ArenaNodos::bytesPorNodo() const { return tamanoNodo * sizeof(uint64_t); }
+
+/**
+ * Desc: Devuelve el total de memoria reservada por la arena.
+ * Params: void
+ * Returns:
+ *   - size_t: Bytes reservados en bloques.
+ */
+size_t ArenaNodos::bytesReservados() const {
+    lock_guard<mutex> lock(mtx);
+    return bloques.size() * nodosPorBloque * bytesPorNodo();
+}
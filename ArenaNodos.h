@@ -0,0 +1,36 @@
+#ifndef ARENA_NODOS_H
+#define ARENA_NODOS_H
+
+#include "NodoCompacto.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+
+using namespace std;
+
+class ArenaNodos {
+private:
+    int numPalabras;
+    size_t tamanoNodo;
+    size_t nodosPorBloque;
+    vector<unique_ptr<uint64_t[]>> bloques;
+    size_t usadosUltimoBloque;
+    vector<NodoCompacto*> libres;
+    size_t vivos;
+    mutable mutex mtx;
+
+    NodoCompacto* reservar();
+
+public:
+    ArenaNodos(int numVariables, size_t nodosPorBloque = 4096);
+
+    NodoCompacto* crear();
+    NodoCompacto* crearHijo(const NodoCompacto* padre);
+    void liberar(NodoCompacto* nodo);
+
+    size_t nodosVivos() const;
+    size_t bytesPorNodo() const;
+    size_t bytesReservados() const;
+};
+
+#endif // ARENA_NODOS_H
@@ -0,0 +1,267 @@
+#include "BusquedaLocal.h"
+#include <algorithm>
+
+static const double INFINITO = 1e20;
+static const double EPS_CAPACIDAD = 1e-9;
+
+/**
+ * Desc: Constructor de la búsqueda local.
+ * Params:
+ *   - maxMovimientos: Máximo de movimientos aceptados por llamada a mejorar().
+ *   - candidatosExactos: Movimientos mejor estimados que se evalúan con el
+ *                        transporte exacto en cada paso.
+ * Returns: void
+ */
+BusquedaLocal::BusquedaLocal(int maxMovimientos, int candidatosExactos)
+    : numClientes(0), numFuentesProd(0), demandaTotal(0.0), maxMovimientos(maxMovimientos),
+      candidatosExactos(candidatosExactos), movimientosAceptados(0), capacidadAbierta(0.0) {}
+
+/**
+ * Desc: Copia los datos del problema. La copia de Problema comparte la matriz de
+ *       costos con el original, así que no duplica memoria.
+ * Params:
+ *   - problema: Referencia constante al problema.
+ * Returns: void
+ */
+void BusquedaLocal::construir(const Problema& problema) {
+    this->problema = make_unique<Problema>(problema);
+    numClientes = problema.getNumClientes();
+    numFuentesProd = problema.getNumFuentesProd();
+    demandas = problema.getDemandas();
+    capacidades = problema.getCapacidades();
+    costosActivacion.resize(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; j++) {
+        costosActivacion[j] = problema.getCostoActivacion(j);
+    }
+    demandaTotal = 0.0;
+    for (double d : demandas) {
+        demandaTotal += d;
+    }
+    mejor1.assign(numClientes, -1);
+    mejor2.assign(numClientes, -1);
+    perdida.assign(numFuentesProd, 0.0);
+    extra.assign(numFuentesProd, 0.0);
+    movimientosAceptados = 0;
+}
+
+/**
+ * Desc: Indica si la búsqueda ya fue construida para algún problema.
+ * Params: void
+ * Returns:
+ *   - bool: True si construir() ya fue llamado.
+ */
+bool BusquedaLocal::estaConstruida() const { return problema != nullptr; }
+
+/**
+ * Desc: Costo de atender toda la demanda de un cliente desde una fuente.
+ * Params:
+ *   - cliente: Índice del cliente.
+ *   - fuenteProd: Índice de la fuente, o -1 si no hay ninguna.
+ * Returns:
+ *   - double: d_i * c_ij, o 1e20 si fuenteProd es -1.
+ */
+double BusquedaLocal::costoAsignacion(int cliente, int fuenteProd) const {
+    return fuenteProd < 0 ? INFINITO : demandas[cliente] * problema->getCostoEnvio(cliente, fuenteProd);
+}
+
+/**
+ * Desc: Recalcula las dos fuentes abiertas más baratas de un cliente.
+ * Params:
+ *   - cliente: Índice del cliente.
+ * Returns: void
+ */
+void BusquedaLocal::recalcularCliente(int cliente) {
+    VistaCostos costos = problema->getCostosCliente(cliente);
+    int primera = -1;
+    int segunda = -1;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (!abierta[j]) {
+            continue;
+        }
+        if (primera < 0 || costos[j] < costos[primera]) {
+            segunda = primera;
+            primera = j;
+        } else if (segunda < 0 || costos[j] < costos[segunda]) {
+            segunda = j;
+        }
+    }
+    mejor1[cliente] = primera;
+    mejor2[cliente] = segunda;
+}
+
+/**
+ * Desc: Carga una solución como punto de partida y arma el estado incremental.
+ * Params:
+ *   - solucion: Vector de activación de fuentes (abierta si y_j > 0.5).
+ * Returns: void
+ */
+void BusquedaLocal::inicializar(const vector<double>& solucion) {
+    abierta.assign(numFuentesProd, 0);
+    capacidadAbierta = 0.0;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (solucion[j] > 0.5) {
+            abierta[j] = 1;
+            capacidadAbierta += capacidades[j];
+        }
+    }
+    for (int i = 0; i < numClientes; i++) {
+        recalcularCliente(i);
+    }
+}
+
+/**
+ * Desc: Estima el cambio de costo de todos los movimientos factibles en capacidad
+ *       y deja en `movimientos` los candidatosExactos mejores, de menor a mayor delta.
+ *       Cerrar j cuesta la pérdida de sus clientes al pasar a su segunda fuente.
+ *       Para cada fuente cerrada k, una pasada por su columna de costos da a la vez
+ *       abrir k y el intercambio de k con cada fuente abierta j (intercambio rápido
+ *       de Whitaker), en O(n + m) por k.
+ * Params: void
+ * Returns: void
+ */
+void BusquedaLocal::generarMovimientos() {
+    movimientos.clear();
+    auto considerar = [this](double delta, int abrir, int cerrar) {
+        if ((int)movimientos.size() < candidatosExactos) {
+            movimientos.push_back({delta, abrir, cerrar});
+            push_heap(movimientos.begin(), movimientos.end());
+        } else if (delta < movimientos.front().delta) {
+            pop_heap(movimientos.begin(), movimientos.end());
+            movimientos.back() = {delta, abrir, cerrar};
+            push_heap(movimientos.begin(), movimientos.end());
+        }
+    };
+
+    // Cerrar
+    fill(perdida.begin(), perdida.end(), 0.0);
+    for (int i = 0; i < numClientes; i++) {
+        if (mejor1[i] >= 0) {
+            perdida[mejor1[i]] += costoAsignacion(i, mejor2[i]) - costoAsignacion(i, mejor1[i]);
+        }
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (abierta[j] && capacidadAbierta - capacidades[j] >= demandaTotal - EPS_CAPACIDAD) {
+            considerar(perdida[j] - costosActivacion[j], -1, j);
+        }
+    }
+
+    // Abrir e intercambiar
+    for (int k = 0; k < numFuentesProd; k++) {
+        if (abierta[k]) {
+            continue;
+        }
+        VistaCostos costosFuente = problema->getCostosFuente(k);
+        fill(extra.begin(), extra.end(), 0.0);
+        double ganancia = 0.0;
+        for (int i = 0; i < numClientes; i++) {
+            double nuevo = demandas[i] * costosFuente[i];
+            double c1 = costoAsignacion(i, mejor1[i]);
+            double g = max(0.0, c1 - nuevo);
+            ganancia += g;
+            if (mejor1[i] >= 0) {
+                extra[mejor1[i]] += min(costoAsignacion(i, mejor2[i]), nuevo) - c1 + g;
+            }
+        }
+        if (capacidadAbierta + capacidades[k] >= demandaTotal - EPS_CAPACIDAD) {
+            considerar(costosActivacion[k] - ganancia, k, -1);
+        }
+        for (int j = 0; j < numFuentesProd; j++) {
+            if (abierta[j] && capacidadAbierta + capacidades[k] - capacidades[j] >= demandaTotal - EPS_CAPACIDAD) {
+                considerar(costosActivacion[k] - costosActivacion[j] - ganancia + extra[j], k, j);
+            }
+        }
+    }
+    sort_heap(movimientos.begin(), movimientos.end());
+}
+
+/**
+ * Desc: Aplica un movimiento al estado incremental. Abrir solo revisa si la nueva
+ *       fuente entra entre las dos mejores de cada cliente; cerrar recalcula solo
+ *       a los clientes que la tenían entre sus dos mejores.
+ * Params:
+ *   - movimiento: Movimiento aceptado.
+ * Returns: void
+ */
+void BusquedaLocal::aplicar(const Movimiento& movimiento) {
+    if (movimiento.abrir >= 0) {
+        int k = movimiento.abrir;
+        abierta[k] = 1;
+        capacidadAbierta += capacidades[k];
+        VistaCostos costosFuente = problema->getCostosFuente(k);
+        for (int i = 0; i < numClientes; i++) {
+            double nuevo = demandas[i] * costosFuente[i];
+            if (nuevo < costoAsignacion(i, mejor1[i])) {
+                mejor2[i] = mejor1[i];
+                mejor1[i] = k;
+            } else if (nuevo < costoAsignacion(i, mejor2[i])) {
+                mejor2[i] = k;
+            }
+        }
+    }
+    if (movimiento.cerrar >= 0) {
+        int j = movimiento.cerrar;
+        abierta[j] = 0;
+        capacidadAbierta -= capacidades[j];
+        for (int i = 0; i < numClientes; i++) {
+            if (mejor1[i] == j || mejor2[i] == j) {
+                recalcularCliente(i);
+            }
+        }
+    }
+}
+
+/**
+ * Desc: Mejora una solución entera con movimientos de abrir, cerrar e intercambiar
+ *       fuentes. En cada paso evalúa con el transporte exacto los movimientos mejor
+ *       estimados y acepta el primero que baja el costo real; termina cuando
+ *       ninguno lo baja o se alcanza el máximo de movimientos.
+ * Params:
+ *   - solucion: Solución de partida; al salir, la mejor encontrada (con valores 0/1).
+ *   - costo: Costo exacto de la solución de partida; al salir, el de la encontrada.
+ *   - evaluador: Evaluador de transporte ya construido para el problema.
+ * Returns:
+ *   - bool: True si encontró una solución más barata.
+ */
+bool BusquedaLocal::mejorar(vector<double>& solucion, double& costo, EvaluadorTransporte& evaluador) {
+    for (double& v : solucion) {
+        v = v > 0.5 ? 1.0 : 0.0;
+    }
+    inicializar(solucion);
+    bool mejoro = false;
+    vector<double> vecina;
+    for (int paso = 0; paso < maxMovimientos; paso++) {
+        generarMovimientos();
+        bool aceptado = false;
+        for (const Movimiento& movimiento : movimientos) {
+            vecina = solucion;
+            if (movimiento.abrir >= 0) {
+                vecina[movimiento.abrir] = 1.0;
+            }
+            if (movimiento.cerrar >= 0) {
+                vecina[movimiento.cerrar] = 0.0;
+            }
+            double costoVecina = evaluador.evaluar(vecina);
+            if (costoVecina < costo - 1e-9) {
+                solucion.swap(vecina);
+                costo = costoVecina;
+                aplicar(movimiento);
+                aceptado = true;
+                break;
+            }
+        }
+        if (!aceptado) {
+            break;
+        }
+        movimientosAceptados++;
+        mejoro = true;
+    }
+    return mejoro;
+}
+
+/**
+ * Desc: Devuelve cuántos movimientos se han aceptado desde construir().
+ * Params: void
+ * Returns:
+ *   - int: Movimientos aceptados.
+ */
+int BusquedaLocal::obtenerMovimientosAceptados() const { return movimientosAceptados; }
@@ -0,0 +1,59 @@
+#ifndef BUSQUEDA_LOCAL_H
+#define BUSQUEDA_LOCAL_H
+
+#include "Problema.h"
+#include "EvaluadorTransporte.h"
+#include <vector>
+#include <memory>
+
+using namespace std;
+
+// Búsqueda local sobre el vector de fuentes abiertas con movimientos de abrir,
+// cerrar e intercambiar. Los movimientos se ordenan con el costo de asignación
+// sin capacidades (cada cliente a su fuente abierta más barata), que se actualiza
+// en forma incremental; solo los mejores se evalúan con el transporte exacto.
+class BusquedaLocal {
+private:
+    struct Movimiento {
+        double delta;  // cambio estimado del costo
+        int abrir;     // -1 si no abre
+        int cerrar;    // -1 si no cierra
+        bool operator<(const Movimiento& otro) const { return delta < otro.delta; }
+    };
+
+    int numClientes;
+    int numFuentesProd;
+    unique_ptr<Problema> problema;  // copia que comparte la matriz de costos
+    vector<double> demandas;
+    vector<double> capacidades;
+    vector<double> costosActivacion;
+    double demandaTotal;
+    int maxMovimientos;
+    int candidatosExactos;
+    int movimientosAceptados;
+
+    // Estado incremental de la solución actual
+    vector<char> abierta;
+    double capacidadAbierta;
+    vector<int> mejor1;   // fuente abierta más barata de cada cliente
+    vector<int> mejor2;   // segunda más barata, -1 si no hay
+    vector<double> perdida;
+    vector<double> extra;
+    vector<Movimiento> movimientos;
+
+    double costoAsignacion(int cliente, int fuenteProd) const;
+    void recalcularCliente(int cliente);
+    void inicializar(const vector<double>& solucion);
+    void generarMovimientos();
+    void aplicar(const Movimiento& movimiento);
+
+public:
+    BusquedaLocal(int maxMovimientos = 50, int candidatosExactos = 5);
+
+    void construir(const Problema& problema);
+    bool estaConstruida() const;
+    bool mejorar(vector<double>& solucion, double& costo, EvaluadorTransporte& evaluador);
+    int obtenerMovimientosAceptados() const;
+};
+
+#endif // BUSQUEDA_LOCAL_H
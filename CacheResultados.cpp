@@ -0,0 +1,157 @@
+#include "CacheResultados.h"
+#include <fstream>
+#include <filesystem>
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+#include <unistd.h>
+
+static const char MAGIA_CACHE[4] = {'C', 'F', 'L', 'R'};
+static const uint32_t VERSION_CACHE = 1;
+
+/**
+ * Desc: Constructor de la caché. El directorio se crea al guardar la primera entrada.
+ * Params:
+ *   - directorio: Directorio donde se guardan las entradas.
+ * Returns: void
+ */
+CacheResultados::CacheResultados(const string& directorio) : directorio(directorio) {}
+
+/**
+ * Desc: Calcula una huella FNV-1a de 64 bits de un texto, estable entre ejecuciones
+ *       y compiladores (a diferencia de std::hash).
+ * Params:
+ *   - texto: Texto a resumir.
+ * Returns:
+ *   - uint64_t: Huella del texto.
+ */
+uint64_t CacheResultados::huellaTexto(const string& texto) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (unsigned char c : texto) {
+        h = (h ^ c) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+/**
+ * Desc: Arma la ruta del archivo de una entrada a partir de la huella del problema
+ *       y de la de los parámetros.
+ * Params:
+ *   - huella: Huella del problema.
+ *   - parametros: Parámetros del solver.
+ * Returns:
+ *   - string: Ruta del archivo de la entrada.
+ */
+string CacheResultados::rutaEntrada(uint64_t huella, const string& parametros) const {
+    char nombre[48];
+    snprintf(nombre, sizeof(nombre), "%016llx-%016llx.res", (unsigned long long)huella,
+             (unsigned long long)huellaTexto(parametros));
+    return (filesystem::path(directorio) / nombre).string();
+}
+
+/**
+ * Desc: Busca el resultado de un problema resuelto antes con los mismos parámetros.
+ *       Una entrada ilegible, de otra versión o cuya huella o parámetros no coinciden
+ *       exactamente (colisión del nombre) se trata como ausente.
+ * Params:
+ *   - huella: Huella del problema.
+ *   - parametros: Parámetros del solver.
+ *   - resultado: Se llena con el resultado guardado si se encuentra.
+ * Returns:
+ *   - bool: True si había una entrada válida.
+ */
+bool CacheResultados::buscar(uint64_t huella, const string& parametros, ResultadoSolucion& resultado) const {
+    ifstream archivo(rutaEntrada(huella, parametros), ios::binary);
+    if (!archivo.is_open()) {
+        return false;
+    }
+    CabeceraCache cabecera;
+    if (!archivo.read(reinterpret_cast<char*>(&cabecera), sizeof(cabecera)) ||
+        memcmp(cabecera.magia, MAGIA_CACHE, sizeof(MAGIA_CACHE)) != 0 || cabecera.version != VERSION_CACHE ||
+        cabecera.huella != huella || cabecera.largoParametros != parametros.size() || cabecera.largoSolucion > (1u << 30)) {
+        return false;
+    }
+    string guardados(parametros.size(), '\0');
+    vector<double> solucion(cabecera.largoSolucion);
+    if (!archivo.read(&guardados[0], guardados.size()) || guardados != parametros ||
+        !archivo.read(reinterpret_cast<char*>(solucion.data()), solucion.size() * sizeof(double))) {
+        return false;
+    }
+
+    resultado = ResultadoSolucion();
+    resultado.valorObjetivo = cabecera.valorObjetivo;
+    resultado.solucionFinal = move(solucion);
+    resultado.esFactible = cabecera.esFactible != 0;
+    resultado.numIteraciones = cabecera.numIteraciones;
+    resultado.tiempoEjecucion = cabecera.tiempoEjecucion;
+    resultado.cotaRaiz = cabecera.cotaRaiz;
+    resultado.cotaInferior = cabecera.cotaInferior;
+    resultado.tiempoRelajacion = cabecera.tiempoRelajacion;
+    resultado.brecha = cabecera.brecha;
+    resultado.motivoTerminacion = static_cast<MotivoTerminacion>(cabecera.motivoTerminacion);
+    return true;
+}
+
+/**
+ * Desc: Guarda el resultado de una resolución. Se escribe un archivo temporal único
+ *       y se renombra sobre la entrada, para que quien lea en paralelo vea la entrada
+ *       completa o no la vea. Las estadísticas de instrumentación no se guardan.
+ * Params:
+ *   - huella: Huella del problema.
+ *   - parametros: Parámetros del solver.
+ *   - resultado: Resultado a guardar.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si no se puede crear el directorio o escribir la entrada.
+ */
+void CacheResultados::guardar(uint64_t huella, const string& parametros, const ResultadoSolucion& resultado) const {
+    static atomic<unsigned> contadorTemporales(0);
+    CabeceraCache cabecera = {};
+    memcpy(cabecera.magia, MAGIA_CACHE, sizeof(cabecera.magia));
+    cabecera.version = VERSION_CACHE;
+    cabecera.huella = huella;
+    cabecera.largoParametros = parametros.size();
+    cabecera.largoSolucion = resultado.solucionFinal.size();
+    cabecera.valorObjetivo = resultado.valorObjetivo;
+    cabecera.tiempoEjecucion = resultado.tiempoEjecucion;
+    cabecera.cotaRaiz = resultado.cotaRaiz;
+    cabecera.cotaInferior = resultado.cotaInferior;
+    cabecera.tiempoRelajacion = resultado.tiempoRelajacion;
+    cabecera.brecha = resultado.brecha;
+    cabecera.numIteraciones = resultado.numIteraciones;
+    cabecera.esFactible = resultado.esFactible;
+    cabecera.motivoTerminacion = resultado.motivoTerminacion;
+
+    error_code error;
+    filesystem::create_directories(directorio, error);
+    string ruta = rutaEntrada(huella, parametros);
+    string temporal = ruta + ".tmp" + to_string(getpid()) + "_" + to_string(contadorTemporales++);
+    {
+        ofstream archivo(temporal, ios::binary);
+        if (!archivo.is_open()) {
+            throw runtime_error("No se pudo crear la entrada de caché: " + temporal);
+        }
+        archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+        archivo.write(parametros.data(), parametros.size());
+        archivo.write(reinterpret_cast<const char*>(resultado.solucionFinal.data()),
+                      resultado.solucionFinal.size() * sizeof(double));
+        if (!archivo.flush()) {
+            archivo.close();
+            filesystem::remove(temporal, error);
+            throw runtime_error("Error al escribir la entrada de caché: " + temporal);
+        }
+    }
+    filesystem::rename(temporal, ruta, error);
+    if (error) {
+        filesystem::remove(temporal, error);
+        throw runtime_error("No se pudo guardar la entrada de caché: " + ruta);
+    }
+}
+
+/**
+ * Desc: Devuelve el directorio de la caché.
+ * Params: void
+ * Returns:
+ *   - const string&: Directorio donde se guardan las entradas.
+ */
+const string& CacheResultados::getDirectorio() const { return directorio; }
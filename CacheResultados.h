@@ -0,0 +1,48 @@
+#ifndef CACHE_RESULTADOS_H
+#define CACHE_RESULTADOS_H
+
+#include "StrategyResolucion.h"
+#include <string>
+#include <cstdint>
+
+using namespace std;
+
+// Cabecera de una entrada de la caché. A continuación van los parámetros del
+// solver (largoParametros bytes) y la solución (largoSolucion doubles).
+struct CabeceraCache {
+    char magia[4];                    // "CFLR"
+    uint32_t version;
+    uint64_t huella;                  // huella del problema
+    uint64_t largoParametros;
+    uint64_t largoSolucion;
+    double valorObjetivo;
+    double tiempoEjecucion;           // tiempo de la resolución original
+    double cotaRaiz;
+    double cotaInferior;
+    double tiempoRelajacion;
+    double brecha;
+    int32_t numIteraciones;
+    int32_t esFactible;
+    int32_t motivoTerminacion;
+    int32_t reservado;
+};
+
+// Caché en disco de resultados, un archivo por combinación de problema (por su
+// huella) y parámetros del solver. Las entradas se escriben en un archivo temporal
+// y se renombran, así que varios procesos o hilos pueden compartir el directorio.
+class CacheResultados {
+private:
+    string directorio;
+
+    static uint64_t huellaTexto(const string& texto);
+    string rutaEntrada(uint64_t huella, const string& parametros) const;
+
+public:
+    CacheResultados(const string& directorio);
+
+    bool buscar(uint64_t huella, const string& parametros, ResultadoSolucion& resultado) const;
+    void guardar(uint64_t huella, const string& parametros, const ResultadoSolucion& resultado) const;
+    const string& getDirectorio() const;
+};
+
+#endif // CACHE_RESULTADOS_H
@@ -1,15 +1,68 @@
 #include "ComparadorNodos.h"
 
 /**
- * Desc: Compara dos nodos del árbol según su cota inferior.
- *       Utilizado para ordenar nodos en una cola de prioridad.
+ * Desc: Constructor del comparador.
+ * Params:
+ *   - politica: Política de selección de nodos (por defecto, mejor cota primero).
+ * Returns: void
+ */
+ComparadorNodos::ComparadorNodos(PoliticaSeleccion politica) : politica(politica) {}
+
+/**
+ * Desc: Compara dos nodos del árbol según la política de selección.
+ *       Utilizado para ordenar nodos en una cola de prioridad, donde el nodo
+ *       "mayor" según este comparador queda al final de la cola.
+ *       NodoArbol no guarda estimación: con MEJOR_ESTIMACION ordena por cota inferior.
+ * Params:
+ *   - a: Primer nodo a comparar.
+ *   - b: Segundo nodo a comparar.
+ * Returns:
+ *   - bool: True si 'a' debe atenderse después que 'b',
+ *           False en caso contrario.
+ */
+bool ComparadorNodos::operator()(const shared_ptr<NodoArbol>& a, const shared_ptr<NodoArbol>& b) const {
+    switch (politica) {
+        case PROFUNDIDAD_PRIMERO:
+            if (a->obtenerProfundidad() != b->obtenerProfundidad()) {
+                return a->obtenerProfundidad() < b->obtenerProfundidad();
+            }
+            return a->obtenerCotaInferior() > b->obtenerCotaInferior();
+        case MEJOR_PRIMERO:
+        default:
+            return a->obtenerCotaInferior() > b->obtenerCotaInferior();
+    }
+}
+
+/**
+ * Desc: Compara dos nodos compactos según la política de selección.
+ *       Mismo criterio que la versión para NodoArbol; con MEJOR_ESTIMACION usa la
+ *       estimación guardada en el nodo.
  * Params:
  *   - a: Primer nodo a comparar.
  *   - b: Segundo nodo a comparar.
  * Returns:
- *   - bool: True si la cota inferior de 'a' es mayor que la de 'b',
+ *   - bool: True si 'a' debe atenderse después que 'b',
  *           False en caso contrario.
  */
-bool ComparadorNodos::operator()(const shared_ptr<NodoArbol>& a, const shared_ptr<NodoArbol>& b) {
-    return a->obtenerCotaInferior() > b->obtenerCotaInferior();
-}
\ No newline at end of file
+bool ComparadorNodos::operator()(const NodoCompacto* a, const NodoCompacto* b) const {
+    switch (politica) {
+        case PROFUNDIDAD_PRIMERO:
+            if (a->profundidad != b->profundidad) {
+                return a->profundidad < b->profundidad;
+            }
+            return a->cotaInferior > b->cotaInferior;
+        case MEJOR_ESTIMACION:
+            return a->estimacion > b->estimacion;
+        case MEJOR_PRIMERO:
+        default:
+            return a->cotaInferior > b->cotaInferior;
+    }
+}
+
+/**
+ * Desc: Devuelve la política de selección usada por el comparador.
+ * Params: void
+ * Returns:
+ *   - PoliticaSeleccion: Política configurada.
+ */
+PoliticaSeleccion ComparadorNodos::obtenerPolitica() const { return politica; }
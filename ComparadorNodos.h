@@ -2,10 +2,23 @@
 #define COMPARADOR_NODOS_H
 #include <memory>
 #include "NodoArbol.h"
+#include "NodoCompacto.h"
+
+enum PoliticaSeleccion {
+    MEJOR_PRIMERO,        // menor cota inferior
+    PROFUNDIDAD_PRIMERO,  // nodo más profundo, desempate por cota
+    MEJOR_ESTIMACION      // menor estimación del costo entero
+};
 
 class ComparadorNodos {
+private:
+    PoliticaSeleccion politica;
+
 public:
-    bool operator()(const shared_ptr<NodoArbol>& a, const shared_ptr<NodoArbol>& b);
+    ComparadorNodos(PoliticaSeleccion politica = MEJOR_PRIMERO);
+    bool operator()(const shared_ptr<NodoArbol>& a, const shared_ptr<NodoArbol>& b) const;
+    bool operator()(const NodoCompacto* a, const NodoCompacto* b) const;
+    PoliticaSeleccion obtenerPolitica() const;
 };
 
-#endif // COMPARADOR_NODOS_H
\ No newline at end of file
+#endif // COMPARADOR_NODOS_H
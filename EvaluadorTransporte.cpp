@@ -0,0 +1,265 @@
+#include "EvaluadorTransporte.h"
+#include <algorithm>
+#include <cmath>
+
+static const double EPS_FLUJO = 1e-9;
+static const double INFINITO = 1e20;
+
+/**
+ * Desc: Constructor por defecto. El grafo se arma en construir().
+ * Params: void
+ * Returns: void
+ */
+EvaluadorTransporte::EvaluadorTransporte()
+    : numClientes(0), numFuentesProd(0), fuente(0), sumidero(0), demandaTotal(0.0), construido(false) {}
+
+/**
+ * Desc: Arma una única vez el grafo bipartito de transporte:
+ *       origen -> cliente i (capacidad d_i), cliente i -> fuente j (costo c_ij)
+ *       y fuente j -> sumidero (capacidad M_j). Entre evaluaciones solo cambia
+ *       la capacidad de los arcos fuente -> sumidero según qué fuentes están abiertas.
+ * Params:
+ *   - problema: Referencia constante al problema.
+ * Returns: void
+ */
+void EvaluadorTransporte::construir(const Problema& problema) {
+    numClientes = problema.getNumClientes();
+    numFuentesProd = problema.getNumFuentesProd();
+    fuente = numClientes + numFuentesProd;
+    sumidero = fuente + 1;
+    int numNodos = sumidero + 1;
+
+    capacidades = problema.getCapacidades();
+    costosActivacion.assign(numFuentesProd, 0.0);
+    for (int j = 0; j < numFuentesProd; j++) {
+        costosActivacion[j] = problema.getCostoActivacion(j);
+    }
+    demandaTotal = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        demandaTotal += problema.getDemanda(i);
+    }
+
+    destino.clear();
+    capacidad.clear();
+    costo.clear();
+    arcosSalientes.assign(numNodos, vector<int>());
+    arcoFuenteCliente.assign(numClientes, -1);
+    arcoFuenteSumidero.assign(numFuentesProd, -1);
+
+    auto agregarArco = [this](int desde, int hasta, double cap, double c) {
+        arcosSalientes[desde].push_back(destino.size());
+        destino.push_back(hasta);
+        capacidad.push_back(cap);
+        costo.push_back(c);
+        arcosSalientes[hasta].push_back(destino.size());
+        destino.push_back(desde);
+        capacidad.push_back(0.0);
+        costo.push_back(-c);
+        return static_cast<int>(destino.size()) - 2;
+    };
+
+    // Clientes en [0, n), fuentes de producción en [n, n+m)
+    for (int i = 0; i < numClientes; i++) {
+        arcoFuenteCliente[i] = agregarArco(fuente, i, problema.getDemanda(i), 0.0);
+    }
+    // Los arcos prohibidos se agregan sin capacidad, para no correr los índices de obtenerFlujo
+    for (int i = 0; i < numClientes; i++) {
+        VistaCostos costosCliente = problema.getCostosCliente(i);
+        for (int j = 0; j < numFuentesProd; j++) {
+            double cap = problema.esArcoPermitido(i, j) ? problema.getDemanda(i) : 0.0;
+            agregarArco(i, numClientes + j, cap, costosCliente[j]);
+        }
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        arcoFuenteSumidero[j] = agregarArco(numClientes + j, sumidero, capacidades[j], 0.0);
+    }
+
+    capacidadInicial = capacidad;
+    potencial.assign(numNodos, 0.0);
+    distancia.assign(numNodos, INFINITO);
+    arcoPrevio.assign(numNodos, -1);
+    construido = true;
+}
+
+/**
+ * Desc: Indica si el grafo ya fue construido.
+ * Params: void
+ * Returns:
+ *   - bool: True si construir() ya fue llamado.
+ */
+bool EvaluadorTransporte::estaConstruido() const { return construido; }
+
+/**
+ * Desc: Calcula el costo exacto de una solución entera: costos fijos de las fuentes
+ *       abiertas más el transporte óptimo hacia ellas.
+ * Params:
+ *   - solucion: Vector de activación de fuentes (abierta si y_j > 0.5).
+ * Returns:
+ *   - double: Costo total de la solución (o 1e20 si no es factible).
+ */
+double EvaluadorTransporte::evaluar(const vector<double>& solucion) {
+    double transporte = evaluarTransporte(solucion);
+    if (transporte >= INFINITO) {
+        return INFINITO;
+    }
+    double costoTotal = transporte;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (solucion[j] > 0.5) {
+            costoTotal += costosActivacion[j];
+        }
+    }
+    return costoTotal;
+}
+
+/**
+ * Desc: Resuelve exactamente el problema de transporte para un conjunto fijo de
+ *       fuentes abiertas con caminos mínimos sucesivos (flujo de costo mínimo).
+ * Params:
+ *   - solucion: Vector de activación de fuentes (abierta si y_j > 0.5).
+ * Returns:
+ *   - double: Costo óptimo de transporte (o 1e20 si la capacidad abierta no cubre la demanda).
+ */
+double EvaluadorTransporte::evaluarTransporte(const vector<double>& solucion) {
+    double capacidadAbierta = 0.0;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (solucion[j] > 0.5) {
+            capacidadAbierta += capacidades[j];
+        }
+    }
+    if (capacidadAbierta < demandaTotal - EPS_FLUJO) {
+        return INFINITO;
+    }
+
+    reiniciarFlujo(solucion);
+    calcularPotencialesIniciales();
+
+    double flujoTotal = 0.0;
+    double costoTotal = 0.0;
+    while (flujoTotal < demandaTotal - EPS_FLUJO && caminoMasCorto()) {
+        // Capacidad del cuello de botella en el camino encontrado
+        double delta = INFINITO;
+        for (int v = sumidero; v != fuente; v = destino[arcoPrevio[v] ^ 1]) {
+            delta = min(delta, capacidad[arcoPrevio[v]]);
+        }
+        for (int v = sumidero; v != fuente; v = destino[arcoPrevio[v] ^ 1]) {
+            int a = arcoPrevio[v];
+            capacidad[a] -= delta;
+            capacidad[a ^ 1] += delta;
+            costoTotal += delta * costo[a];
+        }
+        flujoTotal += delta;
+    }
+
+    if (flujoTotal < demandaTotal - 1e-6) {
+        return INFINITO;
+    }
+    return costoTotal;
+}
+
+/**
+ * Desc: Devuelve el flujo enviado del cliente a la fuente en la última evaluación.
+ * Params:
+ *   - cliente: Índice del cliente.
+ *   - fuenteProd: Índice de la fuente de producción.
+ * Returns:
+ *   - double: Unidades enviadas (x_ij).
+ */
+double EvaluadorTransporte::obtenerFlujo(int cliente, int fuenteProd) const {
+    int arco = 2 * numClientes + 2 * (cliente * numFuentesProd + fuenteProd);
+    return capacidad[arco ^ 1];
+}
+
+/**
+ * Desc: Restaura las capacidades originales y cierra los arcos hacia el sumidero
+ *       de las fuentes no abiertas. No rearma el grafo.
+ * Params:
+ *   - solucion: Vector de activación de fuentes.
+ * Returns: void
+ */
+void EvaluadorTransporte::reiniciarFlujo(const vector<double>& solucion) {
+    copy(capacidadInicial.begin(), capacidadInicial.end(), capacidad.begin());
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (solucion[j] <= 0.5) {
+            capacidad[arcoFuenteSumidero[j]] = 0.0;
+        }
+    }
+}
+
+/**
+ * Desc: Calcula potenciales iniciales válidos recorriendo las capas del grafo
+ *       (origen, clientes, fuentes, sumidero), lo que permite costos negativos
+ *       sin necesitar Bellman-Ford.
+ * Params: void
+ * Returns: void
+ */
+void EvaluadorTransporte::calcularPotencialesIniciales() {
+    fill(potencial.begin(), potencial.end(), INFINITO);
+    potencial[fuente] = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        potencial[i] = 0.0;
+    }
+    for (int i = 0; i < numClientes; i++) {
+        for (int a : arcosSalientes[i]) {
+            if (capacidad[a] > EPS_FLUJO) {
+                potencial[destino[a]] = min(potencial[destino[a]], costo[a]);
+            }
+        }
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        int a = arcoFuenteSumidero[j];
+        if (capacidad[a] > EPS_FLUJO && potencial[numClientes + j] < INFINITO) {
+            potencial[sumidero] = min(potencial[sumidero], potencial[numClientes + j]);
+        }
+    }
+    for (double& p : potencial) {
+        if (p >= INFINITO) {
+            p = 0.0;
+        }
+    }
+}
+
+/**
+ * Desc: Busca el camino de costo reducido mínimo del origen al sumidero con Dijkstra
+ *       y actualiza los potenciales para la siguiente iteración.
+ * Params: void
+ * Returns:
+ *   - bool: True si el sumidero es alcanzable en el grafo residual.
+ */
+bool EvaluadorTransporte::caminoMasCorto() {
+    fill(distancia.begin(), distancia.end(), INFINITO);
+    fill(arcoPrevio.begin(), arcoPrevio.end(), -1);
+    distancia[fuente] = 0.0;
+
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> cola;
+    cola.push({0.0, fuente});
+    while (!cola.empty()) {
+        auto [d, v] = cola.top();
+        cola.pop();
+        if (d > distancia[v]) {
+            continue;
+        }
+        for (int a : arcosSalientes[v]) {
+            if (capacidad[a] <= EPS_FLUJO) {
+                continue;
+            }
+            int w = destino[a];
+            double reducido = costo[a] + potencial[v] - potencial[w];
+            double nd = d + max(0.0, reducido);
+            if (nd < distancia[w] - 1e-12) {
+                distancia[w] = nd;
+                arcoPrevio[w] = a;
+                cola.push({nd, w});
+            }
+        }
+    }
+
+    if (distancia[sumidero] >= INFINITO) {
+        return false;
+    }
+    for (int v = 0; v < (int)potencial.size(); v++) {
+        if (distancia[v] < INFINITO) {
+            potencial[v] += distancia[v];
+        }
+    }
+    return true;
+}
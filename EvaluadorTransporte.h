@@ -0,0 +1,51 @@
+#ifndef EVALUADOR_TRANSPORTE_H
+#define EVALUADOR_TRANSPORTE_H
+
+#include "Problema.h"
+#include <vector>
+#include <queue>
+#include <functional>
+
+using namespace std;
+
+class EvaluadorTransporte {
+private:
+    int numClientes;
+    int numFuentesProd;
+    int fuente;   // nodo origen del flujo
+    int sumidero; // nodo destino del flujo
+    double demandaTotal;
+    bool construido;
+
+    // Grafo residual: arcos en pares (directo, inverso) consecutivos
+    vector<int> destino;
+    vector<double> capacidad;
+    vector<double> costo;
+    vector<double> capacidadInicial;
+    vector<vector<int>> arcosSalientes;
+    vector<int> arcoFuenteCliente;   // arco fuente -> cliente i
+    vector<int> arcoFuenteSumidero;  // arco fuente de producción j -> sumidero
+    vector<double> capacidades;
+    vector<double> costosActivacion;
+
+    // Memoria de trabajo de Dijkstra, reutilizada entre llamadas
+    vector<double> potencial;
+    vector<double> distancia;
+    vector<int> arcoPrevio;
+
+    void reiniciarFlujo(const vector<double>& solucion);
+    void calcularPotencialesIniciales();
+    bool caminoMasCorto();
+
+public:
+    EvaluadorTransporte();
+
+    void construir(const Problema& problema);
+    bool estaConstruido() const;
+
+    double evaluar(const vector<double>& solucion);
+    double evaluarTransporte(const vector<double>& solucion);
+    double obtenerFlujo(int cliente, int fuenteProd) const;
+};
+
+#endif // EVALUADOR_TRANSPORTE_H
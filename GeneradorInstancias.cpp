@@ -0,0 +1,104 @@
+#include "GeneradorInstancias.h"
+#include <cmath>
+
+/**
+ * Desc: Constructor del generador.
+ * Params:
+ *   - semilla: Semilla del generador; la misma semilla repite las instancias.
+ * Returns: void
+ */
+GeneradorInstancias::GeneradorInstancias(uint64_t semilla) : generador(semilla) {}
+
+/**
+ * Desc: Número uniforme en [minimo, maximo). Usa los 53 bits altos del generador en
+ *       vez de uniform_real_distribution, cuyo algoritmo depende de la biblioteca.
+ * Params:
+ *   - minimo: Extremo inferior.
+ *   - maximo: Extremo superior.
+ * Returns:
+ *   - double: Valor uniforme.
+ */
+double GeneradorInstancias::uniforme(double minimo, double maximo) {
+    double u = (generador() >> 11) * 0x1.0p-53;
+    return minimo + (maximo - minimo) * u;
+}
+
+/**
+ * Desc: Devuelve la razón capacidad total / demanda total de una clase.
+ * Params:
+ *   - clase: Clase de instancia.
+ * Returns:
+ *   - double: 3, 5 o 10.
+ */
+double GeneradorInstancias::razonClase(ClaseInstancia clase) {
+    switch (clase) {
+        case CLASE_A:
+            return 3.0;
+        case CLASE_B:
+            return 5.0;
+        default:
+            return 10.0;
+    }
+}
+
+/**
+ * Desc: Genera una instancia. Demandas y capacidades son enteras y la capacidad total
+ *       queda en al menos razon * D; costos de activación y de envío se redondean
+ *       a tres decimales para que el formato de texto los guarde sin pérdida.
+ * Params:
+ *   - numFuentesProd: Número de fuentes.
+ *   - numClientes: Número de clientes.
+ *   - clase: Clase de instancia.
+ *   - razonCapacidad: Razón capacidad / demanda; 0 usa la de la clase.
+ * Returns:
+ *   - Problema: Instancia generada.
+ * Throws:
+ *   - runtime_error: Si las dimensiones no son positivas o la razón es menor que 1.
+ */
+Problema GeneradorInstancias::generar(int numFuentesProd, int numClientes, ClaseInstancia clase,
+                                      double razonCapacidad) {
+    if (numFuentesProd <= 0 || numClientes <= 0) {
+        throw runtime_error("Las dimensiones de la instancia deben ser positivas");
+    }
+    double razon = razonCapacidad > 0 ? razonCapacidad : razonClase(clase);
+    if (razon < 1.0) {
+        throw runtime_error("La razón capacidad / demanda debe ser al menos 1");
+    }
+    auto redondear = [](double valor) { return round(valor * 1000.0) / 1000.0; };
+
+    vector<double> xFuente(numFuentesProd), yFuente(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; j++) {
+        xFuente[j] = uniforme(0.0, 1.0);
+        yFuente[j] = uniforme(0.0, 1.0);
+    }
+    vector<double> xCliente(numClientes), yCliente(numClientes);
+    vector<double> demandas(numClientes);
+    double demandaTotal = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        xCliente[i] = uniforme(0.0, 1.0);
+        yCliente[i] = uniforme(0.0, 1.0);
+        demandas[i] = floor(uniforme(5.0, 36.0));
+        demandaTotal += demandas[i];
+    }
+
+    vector<double> capacidades(numFuentesProd);
+    double capacidadTotal = 0.0;
+    for (int j = 0; j < numFuentesProd; j++) {
+        capacidades[j] = uniforme(10.0, 160.0);
+        capacidadTotal += capacidades[j];
+    }
+    double escala = razon * demandaTotal / capacidadTotal;
+    vector<double> costosActivacion(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; j++) {
+        capacidades[j] = ceil(capacidades[j] * escala);
+        costosActivacion[j] = redondear(uniforme(0.0, 90.0) + uniforme(100.0, 110.0) * sqrt(capacidades[j]));
+    }
+
+    vector<double> costos(size_t(numClientes) * numFuentesProd);
+    for (int i = 0; i < numClientes; i++) {
+        for (int j = 0; j < numFuentesProd; j++) {
+            costos[size_t(i) * numFuentesProd + j] = redondear(10.0 * hypot(xCliente[i] - xFuente[j], yCliente[i] - yFuente[j]));
+        }
+    }
+    return Problema(capacidades, costosActivacion, demandas, costos);
+}
@@ -0,0 +1,37 @@
+#ifndef GENERADOR_INSTANCIAS_H
+#define GENERADOR_INSTANCIAS_H
+
+#include "Problema.h"
+#include <vector>
+#include <cstdint>
+#include <random>
+
+using namespace std;
+
+// Clases de Cornuejols, Sridharan y Thizy: solo cambia la razón entre la capacidad
+// total y la demanda total
+enum ClaseInstancia {
+    CLASE_A,  // razón 3, capacidad ajustada
+    CLASE_B,  // razón 5
+    CLASE_C   // razón 10, capacidad holgada
+};
+
+// Genera instancias CFL aleatorias al estilo de Cornuejols et al.: clientes y fuentes
+// uniformes en el cuadrado unitario, d_i en [5, 35], M_j en [10, 160] escaladas a la
+// razón pedida, f_j = U[0, 90] + U[100, 110] * sqrt(M_j) y costo unitario de envío
+// 10 veces la distancia euclidiana. Los números salen solo de mt19937_64, así que
+// la misma semilla da la misma instancia en cualquier compilador.
+class GeneradorInstancias {
+private:
+    mt19937_64 generador;
+
+    double uniforme(double minimo, double maximo);
+
+public:
+    GeneradorInstancias(uint64_t semilla = 1);
+
+    Problema generar(int numFuentesProd, int numClientes, ClaseInstancia clase, double razonCapacidad = 0.0);
+    static double razonClase(ClaseInstancia clase);
+};
+
+#endif // GENERADOR_INSTANCIAS_H
@@ -0,0 +1,63 @@
+#include "HeuristicaBuceo.h"
+#include <cmath>
+
+/**
+ * Desc: Constructor de la heurística de buceo.
+ * Params:
+ *   - frecuencia: Se ejecuta cada cuántos nodos.
+ *   - presupuestoSegundos: Tiempo máximo por ejecución.
+ * Returns: void
+ */
+HeuristicaBuceo::HeuristicaBuceo(int frecuencia, double presupuestoSegundos)
+    : HeuristicaPrimal(frecuencia, presupuestoSegundos) {}
+
+/**
+ * Desc: Fija la y_j libre más cercana a un entero a su redondeo y resuelve de nuevo;
+ *       si esa rama es infactible o no puede mejorar al incumbente, prueba una vez
+ *       el valor contrario. Termina al llegar a y entera (que se evalúa con el
+ *       transporte exacto), al quedar sin ramas o al agotar el tiempo.
+ * Params:
+ *   - contexto: Nodo recién acotado con la cota LP.
+ *   - solucion: Salida con la solución encontrada.
+ *   - costo: Salida con su costo exacto.
+ * Returns:
+ *   - bool: True si el buceo llegó a una solución entera.
+ */
+bool HeuristicaBuceo::buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) {
+    ModeloRelajacionLP& modelo = *contexto.modelo;
+    vector<double> y = *contexto.valoresY;
+    int numFuentesProd = y.size();
+    map<int, int> fijadas = fijacionesNodo(*contexto.nodo, numFuentesProd);
+    auto podada = [&]() {
+        return !modelo.resolver(fijadas, vector<unsigned char>()) ||
+               modelo.obtenerValorObjetivo() >= contexto.cotaSup - contexto.tolerancia;
+    };
+
+    while (!tiempoAgotado(contexto)) {
+        int var = -1;
+        double menorFraccion = 1.0;
+        for (int j = 0; j < numFuentesProd; j++) {
+            double fraccion = abs(y[j] - round(y[j]));
+            if (fraccion > 1e-6 && fraccion < menorFraccion && fijadas.count(j) == 0) {
+                menorFraccion = fraccion;
+                var = j;
+            }
+        }
+        if (var == -1) {
+            costo = evaluarRedondeo(contexto, y, solucion);
+            return true;
+        }
+
+        int valor = (int)round(y[var]);
+        fijadas[var] = valor;
+        if (podada()) {
+            fijadas[var] = 1 - valor;
+            if (podada()) {
+                return false;
+            }
+        }
+        const double* valoresY = modelo.obtenerValoresY();
+        y.assign(valoresY, valoresY + numFuentesProd);
+    }
+    return false;
+}
@@ -0,0 +1,18 @@
+#ifndef HEURISTICA_BUCEO_H
+#define HEURISTICA_BUCEO_H
+
+#include "HeuristicaPrimal.h"
+
+// Buceo fraccionario: baja por el árbol desde el nodo fijando en cada paso la
+// variable menos fraccionaria y volviendo a resolver el LP desde la base actual.
+class HeuristicaBuceo : public HeuristicaPrimal {
+protected:
+    bool buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) override;
+
+public:
+    HeuristicaBuceo(int frecuencia = 10, double presupuestoSegundos = 0.5);
+
+    string getNombre() const override { return "Buceo fraccionario"; }
+};
+
+#endif // HEURISTICA_BUCEO_H
@@ -0,0 +1,177 @@
+#include "HeuristicaPrimal.h"
+#include <cmath>
+
+/**
+ * Desc: Constructor de la heurística.
+ * Params:
+ *   - frecuencia: Se ejecuta cada cuántos nodos (0 o menos la desactiva).
+ *   - presupuestoSegundos: Tiempo máximo por ejecución.
+ * Returns: void
+ */
+HeuristicaPrimal::HeuristicaPrimal(int frecuencia, double presupuestoSegundos)
+    : frecuencia(frecuencia), presupuestoSegundos(presupuestoSegundos), llamadas(0), exitos(0), mejoras(0), segundos(0.0) {}
+
+/**
+ * Desc: Indica si la heurística corresponde en este nodo: siempre en la raíz
+ *       (iteración 0) y luego cada `frecuencia` nodos.
+ * Params:
+ *   - iteracion: Nodos procesados hasta ahora.
+ * Returns:
+ *   - bool: True si debe ejecutarse.
+ */
+bool HeuristicaPrimal::debeEjecutarse(int iteracion) const {
+    return frecuencia > 0 && iteracion % frecuencia == 0;
+}
+
+/**
+ * Desc: Ejecuta la heurística con su presupuesto de tiempo y registra si encontró
+ *       una solución factible y si mejoró al incumbente.
+ * Params:
+ *   - contexto: Nodo recién acotado y estado de la búsqueda.
+ *   - solucion: Salida con la solución encontrada.
+ *   - costo: Salida con su costo exacto.
+ * Returns:
+ *   - bool: True si la solución encontrada es mejor que contexto.cotaSup.
+ */
+bool HeuristicaPrimal::ejecutar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) {
+    auto inicio = chrono::high_resolution_clock::now();
+    contexto.limite = inicio + chrono::duration_cast<chrono::high_resolution_clock::duration>(chrono::duration<double>(presupuestoSegundos));
+    costo = 1e20;
+    bool encontrada = buscar(contexto, solucion, costo) && costo < 1e20;
+    bool mejora = encontrada && costo < contexto.cotaSup - contexto.tolerancia;
+    auto fin = chrono::high_resolution_clock::now();
+
+    lock_guard<mutex> lock(mtx);
+    llamadas++;
+    exitos += encontrada;
+    mejoras += mejora;
+    segundos += chrono::duration<double>(fin - inicio).count();
+    return mejora;
+}
+
+/**
+ * Desc: Indica si se acabó el presupuesto de tiempo de la ejecución en curso.
+ *       El límite va en el contexto porque los hilos comparten la heurística.
+ * Params:
+ *   - contexto: Contexto de la ejecución.
+ * Returns:
+ *   - bool: True si se pasó el límite.
+ */
+bool HeuristicaPrimal::tiempoAgotado(const ContextoHeuristica& contexto) {
+    return chrono::high_resolution_clock::now() > contexto.limite;
+}
+
+/**
+ * Desc: Traduce los conjuntos de bits de un nodo al mapa de variables fijadas que
+ *       acepta ModeloRelajacionLP::resolver.
+ * Params:
+ *   - nodo: Nodo del árbol.
+ *   - numFuentesProd: Número de variables y_j.
+ * Returns:
+ *   - map<int, int>: Variable -> valor fijado.
+ */
+map<int, int> HeuristicaPrimal::fijacionesNodo(const NodoCompacto& nodo, int numFuentesProd) {
+    map<int, int> fijadas;
+    for (int j = 0; j < numFuentesProd; j++) {
+        uint64_t bit = uint64_t(1) << (j % 64);
+        if (nodo.fijadasCero()[j / 64] & bit) {
+            fijadas[j] = 0;
+        } else if (nodo.fijadasUno()[j / 64] & bit) {
+            fijadas[j] = 1;
+        }
+    }
+    return fijadas;
+}
+
+/**
+ * Desc: Redondea unas y_j casi enteras y evalúa la solución con el transporte exacto.
+ * Params:
+ *   - contexto: Contexto de la heurística (su evaluador).
+ *   - valoresY: Valores y_j enteros salvo error numérico.
+ *   - solucion: Salida con la solución redondeada.
+ * Returns:
+ *   - double: Costo exacto (1e20 si no es factible).
+ */
+double HeuristicaPrimal::evaluarRedondeo(ContextoHeuristica& contexto, const vector<double>& valoresY, vector<double>& solucion) {
+    solucion.resize(valoresY.size());
+    for (size_t j = 0; j < valoresY.size(); j++) {
+        solucion[j] = round(valoresY[j]);
+    }
+    return contexto.evaluador->evaluar(solucion);
+}
+
+/**
+ * Desc: Cambia cada cuántos nodos se ejecuta la heurística.
+ * Params:
+ *   - nodos: Nodos entre ejecuciones; 0 o menos la desactiva.
+ * Returns: void
+ */
+void HeuristicaPrimal::setFrecuencia(int nodos) { frecuencia = nodos; }
+
+/**
+ * Desc: Cambia el tiempo máximo de cada ejecución.
+ * Params:
+ *   - segundos: Presupuesto en segundos.
+ * Returns: void
+ */
+void HeuristicaPrimal::setPresupuesto(double segundos) { presupuestoSegundos = segundos; }
+
+/**
+ * Desc: Devuelve cada cuántos nodos se ejecuta la heurística.
+ * Params: void
+ * Returns:
+ *   - int: Nodos entre ejecuciones; 0 o menos si está desactivada.
+ */
+int HeuristicaPrimal::getFrecuencia() const { return frecuencia; }
+
+/**
+ * Desc: Devuelve el tiempo máximo de cada ejecución.
+ * Params: void
+ * Returns:
+ *   - double: Presupuesto en segundos.
+ */
+double HeuristicaPrimal::getPresupuesto() const { return presupuestoSegundos; }
+
+/**
+ * Desc: Devuelve cuántas veces se ha ejecutado la heurística.
+ * Params: void
+ * Returns:
+ *   - int: Ejecuciones.
+ */
+int HeuristicaPrimal::obtenerLlamadas() const {
+    lock_guard<mutex> lock(mtx);
+    return llamadas;
+}
+
+/**
+ * Desc: Devuelve cuántas ejecuciones encontraron una solución factible.
+ * Params: void
+ * Returns:
+ *   - int: Ejecuciones exitosas.
+ */
+int HeuristicaPrimal::obtenerExitos() const {
+    lock_guard<mutex> lock(mtx);
+    return exitos;
+}
+
+/**
+ * Desc: Devuelve cuántas ejecuciones mejoraron al incumbente.
+ * Params: void
+ * Returns:
+ *   - int: Ejecuciones que mejoraron.
+ */
+int HeuristicaPrimal::obtenerMejoras() const {
+    lock_guard<mutex> lock(mtx);
+    return mejoras;
+}
+
+/**
+ * Desc: Devuelve el tiempo total gastado en la heurística.
+ * Params: void
+ * Returns:
+ *   - double: Segundos acumulados.
+ */
+double HeuristicaPrimal::obtenerSegundos() const {
+    lock_guard<mutex> lock(mtx);
+    return segundos;
+}
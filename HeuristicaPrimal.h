@@ -0,0 +1,68 @@
+#ifndef HEURISTICA_PRIMAL_H
+#define HEURISTICA_PRIMAL_H
+
+#include "Problema.h"
+#include "ModeloRelajacionLP.h"
+#include "EvaluadorTransporte.h"
+#include "NodoCompacto.h"
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <mutex>
+
+using namespace std;
+
+// Lo que una heurística recibe de un nodo recién acotado. El modelo y el evaluador
+// son los del hilo; el modelo queda con el último solve de la heurística, así que el
+// siguiente nodo debe cargar sus propios límites y base (como ya hace acotarNodo).
+struct ContextoHeuristica {
+    const Problema* problema;
+    ModeloRelajacionLP* modelo;       // nullptr con la cota Lagrangeana
+    EvaluadorTransporte* evaluador;
+    const NodoCompacto* nodo;
+    const vector<double>* valoresY;   // solución de la relajación del nodo
+    const vector<double>* incumbente; // vacío si aún no hay
+    double cotaSup;
+    double tolerancia;
+    chrono::high_resolution_clock::time_point limite;  // lo fija ejecutar()
+};
+
+// Heurística primal que parte de la solución de la relajación de un nodo.
+// Se ejecuta cada `frecuencia` nodos (siempre en la raíz) con un presupuesto de
+// tiempo, y lleva estadísticas de éxito. Es compartida por los hilos.
+class HeuristicaPrimal {
+protected:
+    int frecuencia;
+    double presupuestoSegundos;
+    int llamadas;
+    int exitos;
+    int mejoras;
+    double segundos;
+    mutable mutex mtx;
+
+    static bool tiempoAgotado(const ContextoHeuristica& contexto);
+    static map<int, int> fijacionesNodo(const NodoCompacto& nodo, int numFuentesProd);
+    static double evaluarRedondeo(ContextoHeuristica& contexto, const vector<double>& valoresY, vector<double>& solucion);
+    virtual bool buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) = 0;
+
+public:
+    HeuristicaPrimal(int frecuencia, double presupuestoSegundos);
+    virtual ~HeuristicaPrimal() = default;
+
+    bool debeEjecutarse(int iteracion) const;
+    bool ejecutar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo);
+    virtual bool usaLP() const { return true; }
+    virtual string getNombre() const = 0;
+
+    void setFrecuencia(int nodos);
+    void setPresupuesto(double segundos);
+    int getFrecuencia() const;
+    double getPresupuesto() const;
+    int obtenerLlamadas() const;
+    int obtenerExitos() const;
+    int obtenerMejoras() const;
+    double obtenerSegundos() const;
+};
+
+#endif // HEURISTICA_PRIMAL_H
@@ -0,0 +1,94 @@
+#include "HeuristicaRINS.h"
+#include <cmath>
+
+/**
+ * Desc: Constructor de la heurística RINS.
+ * Params:
+ *   - frecuencia: Se ejecuta cada cuántos nodos.
+ *   - presupuestoSegundos: Tiempo máximo por ejecución.
+ *   - maxNodos: Máximo de LPs del sub-árbol por ejecución.
+ * Returns: void
+ */
+HeuristicaRINS::HeuristicaRINS(int frecuencia, double presupuestoSegundos, int maxNodos)
+    : HeuristicaPrimal(frecuencia, presupuestoSegundos), maxNodos(maxNodos) {}
+
+/**
+ * Desc: Arma el vecindario (fijaciones del nodo más las y_j libres que coinciden con
+ *       el incumbente) y lo recorre en profundidad, ramificando en la variable más
+ *       fraccionaria y probando primero su redondeo. Se poda con la mejor solución
+ *       encontrada, que parte del incumbente.
+ * Params:
+ *   - contexto: Nodo recién acotado con la cota LP; requiere un incumbente.
+ *   - solucion: Salida con la mejor solución del vecindario.
+ *   - costo: Salida con su costo exacto.
+ * Returns:
+ *   - bool: True si encontró una solución más barata que el incumbente.
+ */
+bool HeuristicaRINS::buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) {
+    const vector<double>& incumbente = *contexto.incumbente;
+    const vector<double>& y = *contexto.valoresY;
+    int numFuentesProd = y.size();
+    if ((int)incumbente.size() != numFuentesProd) {
+        return false;
+    }
+
+    map<int, int> raiz = fijacionesNodo(*contexto.nodo, numFuentesProd);
+    size_t fijadasNodo = raiz.size();
+    int libres = 0;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (raiz.count(j)) {
+            continue;
+        }
+        if (abs(y[j] - incumbente[j]) < 1e-6) {
+            raiz[j] = (int)round(incumbente[j]);
+        } else {
+            libres++;
+        }
+    }
+    // Un vecindario vacío es el incumbente mismo; uno sin fijar nada es el nodo entero
+    if (libres == 0 || raiz.size() == fijadasNodo) {
+        return false;
+    }
+
+    ModeloRelajacionLP& modelo = *contexto.modelo;
+    double mejor = contexto.cotaSup;
+    vector<map<int, int>> pila = {raiz};
+    vector<double> candidata;
+    int nodos = 0;
+    while (!pila.empty() && nodos < maxNodos && !tiempoAgotado(contexto)) {
+        map<int, int> fijadas = move(pila.back());
+        pila.pop_back();
+        nodos++;
+        if (!modelo.resolver(fijadas, vector<unsigned char>()) ||
+            modelo.obtenerValorObjetivo() >= mejor - contexto.tolerancia) {
+            continue;
+        }
+
+        const double* valoresY = modelo.obtenerValoresY();
+        int var = -1;
+        double mayorFraccion = 1e-6;
+        for (int j = 0; j < numFuentesProd; j++) {
+            double fraccion = abs(valoresY[j] - round(valoresY[j]));
+            if (fraccion > mayorFraccion) {
+                mayorFraccion = fraccion;
+                var = j;
+            }
+        }
+        if (var == -1) {
+            double costoCandidata = evaluarRedondeo(contexto, vector<double>(valoresY, valoresY + numFuentesProd), candidata);
+            if (costoCandidata < mejor - contexto.tolerancia) {
+                mejor = costoCandidata;
+                costo = costoCandidata;
+                solucion = candidata;
+            }
+            continue;
+        }
+
+        int cercano = (int)round(valoresY[var]);
+        for (int valor : {1 - cercano, cercano}) {
+            fijadas[var] = valor;
+            pila.push_back(fijadas);
+        }
+    }
+    return costo < contexto.cotaSup;
+}
@@ -0,0 +1,22 @@
+#ifndef HEURISTICA_RINS_H
+#define HEURISTICA_RINS_H
+
+#include "HeuristicaPrimal.h"
+
+// RINS (Relaxation Induced Neighborhood Search): fija las y_j en que la relajación
+// del nodo coincide con el incumbente y explora el resto con un Branch and Bound
+// en profundidad limitado en nodos.
+class HeuristicaRINS : public HeuristicaPrimal {
+private:
+    int maxNodos;
+
+protected:
+    bool buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) override;
+
+public:
+    HeuristicaRINS(int frecuencia = 50, double presupuestoSegundos = 1.0, int maxNodos = 100);
+
+    string getNombre() const override { return "RINS"; }
+};
+
+#endif // HEURISTICA_RINS_H
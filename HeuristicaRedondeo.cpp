@@ -0,0 +1,62 @@
+#include "HeuristicaRedondeo.h"
+#include <algorithm>
+#include <numeric>
+
+/**
+ * Desc: Constructor de la heurística de redondeo.
+ * Params:
+ *   - frecuencia: Se ejecuta cada cuántos nodos.
+ *   - presupuestoSegundos: Tiempo máximo por ejecución.
+ * Returns: void
+ */
+HeuristicaRedondeo::HeuristicaRedondeo(int frecuencia, double presupuestoSegundos)
+    : HeuristicaPrimal(frecuencia, presupuestoSegundos) {}
+
+/**
+ * Desc: Prueba dos redondeos de las y_j y se queda con el más barato:
+ *       abrir toda fuente con y_j > 0 (siempre factible si la relajación lo es) y
+ *       abrir fuentes de mayor a menor y_j hasta cubrir la demanda total.
+ * Params:
+ *   - contexto: Nodo recién acotado.
+ *   - solucion: Salida con la mejor solución redondeada.
+ *   - costo: Salida con su costo exacto.
+ * Returns:
+ *   - bool: True si algún redondeo es factible.
+ */
+bool HeuristicaRedondeo::buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) {
+    const vector<double>& y = *contexto.valoresY;
+    const vector<double>& capacidades = contexto.problema->getCapacidades();
+    int numFuentesProd = y.size();
+
+    vector<double> hacia(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; j++) {
+        hacia[j] = y[j] > 1e-6 ? 1.0 : 0.0;
+    }
+    costo = evaluarRedondeo(contexto, hacia, solucion);
+
+    double demandaTotal = 0.0;
+    for (double d : contexto.problema->getDemandas()) {
+        demandaTotal += d;
+    }
+    vector<int> orden(numFuentesProd);
+    iota(orden.begin(), orden.end(), 0);
+    sort(orden.begin(), orden.end(), [&y](int a, int b) { return y[a] > y[b]; });
+    fill(hacia.begin(), hacia.end(), 0.0);
+    double capacidadAbierta = 0.0;
+    for (int j : orden) {
+        if (capacidadAbierta >= demandaTotal - 1e-9 || y[j] <= 1e-6) {
+            break;
+        }
+        hacia[j] = 1.0;
+        capacidadAbierta += capacidades[j];
+    }
+    if (capacidadAbierta >= demandaTotal - 1e-9) {
+        vector<double> alternativa;
+        double costoAlternativa = evaluarRedondeo(contexto, hacia, alternativa);
+        if (costoAlternativa < costo) {
+            costo = costoAlternativa;
+            solucion.swap(alternativa);
+        }
+    }
+    return costo < 1e20;
+}
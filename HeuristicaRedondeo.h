@@ -0,0 +1,19 @@
+#ifndef HEURISTICA_REDONDEO_H
+#define HEURISTICA_REDONDEO_H
+
+#include "HeuristicaPrimal.h"
+
+// Redondeo simple de la solución de la relajación: no resuelve LPs, así que es
+// barata y sirve también con la cota Lagrangeana.
+class HeuristicaRedondeo : public HeuristicaPrimal {
+protected:
+    bool buscar(ContextoHeuristica& contexto, vector<double>& solucion, double& costo) override;
+
+public:
+    HeuristicaRedondeo(int frecuencia = 1, double presupuestoSegundos = 0.1);
+
+    bool usaLP() const override { return false; }
+    string getNombre() const override { return "Redondeo"; }
+};
+
+#endif // HEURISTICA_REDONDEO_H
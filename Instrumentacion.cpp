@@ -0,0 +1,129 @@
+#include "Instrumentacion.h"
+#include <iostream>
+#include <iomanip>
+
+/**
+ * Desc: Constructor de la instrumentación, con todo en cero.
+ * Params: void
+ * Returns: void
+ */
+Instrumentacion::Instrumentacion() { reiniciar(); }
+
+/**
+ * Desc: Pone en cero tiempos, contadores e histograma, al empezar una resolución.
+ * Params: void
+ * Returns: void
+ */
+void Instrumentacion::reiniciar() {
+    for (auto& ns : nanosegundos) {
+        ns = 0;
+    }
+    nodosCreados = 0;
+    podadosPorCota = 0;
+    podadosInfactibles = 0;
+    nodosEnteros = 0;
+    for (auto& cantidad : histograma) {
+        cantidad = 0;
+    }
+}
+
+/**
+ * Desc: Registra cuántas iteraciones de simplex tomó un LP, en el intervalo
+ *       logarítmico que le corresponde.
+ * Params:
+ *   - iteraciones: Iteraciones del último LP.
+ * Returns: void
+ */
+void Instrumentacion::registrarIteracionesLP(int iteraciones) {
+    int intervalo = 0;
+    while (iteraciones > 0 && intervalo < NUM_INTERVALOS_ITERACIONES - 1) {
+        iteraciones >>= 1;
+        intervalo++;
+    }
+    histograma[intervalo].fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * Desc: Copia los valores acumulados, para dejarlos en el resultado.
+ * Params: void
+ * Returns:
+ *   - EstadisticasResolucion: Tiempos en segundos, contadores e histograma.
+ */
+EstadisticasResolucion Instrumentacion::obtenerEstadisticas() const {
+    EstadisticasResolucion estadisticas;
+    for (int f = 0; f < NUM_FASES; f++) {
+        estadisticas.segundosFase[f] = nanosegundos[f].load(memory_order_relaxed) * 1e-9;
+    }
+    estadisticas.nodosCreados = nodosCreados.load(memory_order_relaxed);
+    estadisticas.podadosPorCota = podadosPorCota.load(memory_order_relaxed);
+    estadisticas.podadosInfactibles = podadosInfactibles.load(memory_order_relaxed);
+    estadisticas.nodosEnteros = nodosEnteros.load(memory_order_relaxed);
+    for (int k = 0; k < NUM_INTERVALOS_ITERACIONES; k++) {
+        estadisticas.histogramaIteracionesLP[k] = histograma[k].load(memory_order_relaxed);
+    }
+    return estadisticas;
+}
+
+/**
+ * Desc: Nombre de una fase, para los reportes.
+ * Params:
+ *   - fase: Fase del solver.
+ * Returns:
+ *   - string: Nombre corto de la fase.
+ */
+string EstadisticasResolucion::nombreFase(FaseSolver fase) {
+    switch (fase) {
+        case FASE_CONSTRUIR_RELAJACION:
+            return "construir relajación";
+        case FASE_CORTES:
+            return "cortes";
+        case FASE_RELAJACION:
+            return "relajación";
+        case FASE_COSTO_EXACTO:
+            return "costo exacto";
+        case FASE_HEURISTICAS:
+            return "heurísticas";
+        case FASE_BUSQUEDA_LOCAL:
+            return "búsqueda local";
+        case FASE_NODOS:
+            return "nodos";
+        default:
+            return "cola";
+    }
+}
+
+/**
+ * Desc: Imprime en consola los tiempos por fase, los contadores de nodos y los
+ *       intervalos no vacíos del histograma de iteraciones LP.
+ * Params: void
+ * Returns: void
+ */
+void EstadisticasResolucion::imprimir() const {
+    ios::fmtflags formato = cout.flags();
+    streamsize precision = cout.precision();
+    cout << "Tiempo por fase (s):";
+    for (int f = 0; f < NUM_FASES; f++) {
+        cout << " " << nombreFase(FaseSolver(f)) << " " << fixed << setprecision(3) << segundosFase[f]
+             << (f + 1 < NUM_FASES ? "," : "\n");
+    }
+    cout << "Nodos: " << nodosCreados << " creados, " << podadosPorCota << " podados por cota, " << podadosInfactibles
+         << " infactibles, " << nodosEnteros << " enteros\n";
+    cout << "Iteraciones LP:";
+    for (int k = 0; k < NUM_INTERVALOS_ITERACIONES; k++) {
+        if (histogramaIteracionesLP[k] == 0) {
+            continue;
+        }
+        long desde = k == 0 ? 0 : 1L << (k - 1);
+        long hasta = k == 0 ? 0 : (1L << k) - 1;
+        cout << " [" << desde;
+        if (k == NUM_INTERVALOS_ITERACIONES - 1) {
+            cout << "+";
+        } else if (hasta > desde) {
+            cout << "-" << hasta;
+        }
+        cout << "]: " << histogramaIteracionesLP[k];
+    }
+    cout << "\n";
+    cout.flags(formato);
+    cout.precision(precision);
+}
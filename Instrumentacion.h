@@ -0,0 +1,96 @@
+#ifndef INSTRUMENTACION_H
+#define INSTRUMENTACION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Fases del solver medidas por TemporizadorFase
+enum FaseSolver {
+    FASE_CONSTRUIR_RELAJACION,  // armar el LP o la relajación Lagrangeana
+    FASE_CORTES,                // separación en la raíz
+    FASE_RELAJACION,            // acotar nodos
+    FASE_COSTO_EXACTO,          // transporte de las soluciones enteras
+    FASE_HEURISTICAS,
+    FASE_BUSQUEDA_LOCAL,
+    FASE_NODOS,                 // crear y liberar nodos (copias de fijaciones y bases)
+    FASE_COLA,                  // insertar, extraer y podar el pool
+    NUM_FASES
+};
+
+// Intervalos del histograma de iteraciones LP: 0, 1, 2-3, 4-7, ..., 2^14 o más
+static const int NUM_INTERVALOS_ITERACIONES = 16;
+
+// Lo que queda de la instrumentación al terminar una resolución. Con la
+// instrumentación desactivada al compilar, todo queda en cero.
+struct EstadisticasResolucion {
+    double segundosFase[NUM_FASES] = {};
+    long nodosCreados = 0;
+    long podadosPorCota = 0;
+    long podadosInfactibles = 0;
+    long nodosEnteros = 0;
+    long histogramaIteracionesLP[NUM_INTERVALOS_ITERACIONES] = {};
+
+    static string nombreFase(FaseSolver fase);
+    void imprimir() const;
+};
+
+// Contadores y tiempos por fase del solver, compartidos entre hilos (atómicos con
+// orden relajado). Se usan a través de MEDIR_FASE y CONTAR_INSTRUMENTACION, que
+// desaparecen al compilar sin -DINSTRUMENTACION.
+class Instrumentacion {
+private:
+    atomic<int64_t> nanosegundos[NUM_FASES];
+    atomic<long> nodosCreados;
+    atomic<long> podadosPorCota;
+    atomic<long> podadosInfactibles;
+    atomic<long> nodosEnteros;
+    atomic<long> histograma[NUM_INTERVALOS_ITERACIONES];
+
+public:
+    Instrumentacion();
+
+    void reiniciar();
+    void sumarTiempo(FaseSolver fase, int64_t ns) { nanosegundos[fase].fetch_add(ns, memory_order_relaxed); }
+    void contarCreado(long cantidad = 1) { nodosCreados.fetch_add(cantidad, memory_order_relaxed); }
+    void contarPodadoPorCota(long cantidad = 1) { podadosPorCota.fetch_add(cantidad, memory_order_relaxed); }
+    void contarInfactible() { podadosInfactibles.fetch_add(1, memory_order_relaxed); }
+    void contarEntero() { nodosEnteros.fetch_add(1, memory_order_relaxed); }
+    void registrarIteracionesLP(int iteraciones);
+    EstadisticasResolucion obtenerEstadisticas() const;
+};
+
+// Suma al salir de su alcance el tiempo transcurrido a una fase
+class TemporizadorFase {
+private:
+    Instrumentacion& instrumentacion;
+    FaseSolver fase;
+    chrono::steady_clock::time_point inicio;
+
+public:
+    TemporizadorFase(Instrumentacion& instrumentacion, FaseSolver fase)
+        : instrumentacion(instrumentacion), fase(fase), inicio(chrono::steady_clock::now()) {}
+    ~TemporizadorFase() {
+        auto ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count();
+        instrumentacion.sumarTiempo(fase, ns);
+    }
+    TemporizadorFase(const TemporizadorFase&) = delete;
+    TemporizadorFase& operator=(const TemporizadorFase&) = delete;
+};
+
+#define INSTRUMENTACION_CONCAT2(a, b) a##b
+#define INSTRUMENTACION_CONCAT(a, b) INSTRUMENTACION_CONCAT2(a, b)
+
+#ifdef INSTRUMENTACION
+#define MEDIR_FASE(instr, fase) TemporizadorFase INSTRUMENTACION_CONCAT(temporizador_, __LINE__)((instr), (fase))
+#define CONTAR_INSTRUMENTACION(instr, llamada) (instr).llamada
+#else
+#define MEDIR_FASE(instr, fase) ((void)0)
+#define CONTAR_INSTRUMENTACION(instr, llamada) ((void)0)
+#endif
+
+#endif // INSTRUMENTACION_H
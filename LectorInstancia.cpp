@@ -0,0 +1,162 @@
+#include "LectorInstancia.h"
+#include <charconv>
+#include <stdexcept>
+
+/**
+ * Desc: Constructor del lector. No copia los datos: deben vivir mientras se lee.
+ * Params:
+ *   - datos: Contenido del archivo.
+ *   - tamano: Bytes del contenido.
+ *   - nombreArchivo: Nombre usado en los mensajes de error.
+ * Returns: void
+ */
+LectorInstancia::LectorInstancia(const char* datos, size_t tamano, const string& nombreArchivo)
+    : actual(datos), fin(datos + tamano), inicioLinea(datos), linea(1), nombreArchivo(nombreArchivo) {}
+
+/**
+ * Desc: Avanza sobre espacios, tabulaciones y saltos de línea, contando las líneas.
+ * Params: void
+ * Returns: void
+ */
+void LectorInstancia::saltarEspacios() {
+    while (actual < fin) {
+        char c = *actual;
+        if (c == '\n') {
+            linea++;
+            inicioLinea = actual + 1;
+        } else if (c != ' ' && c != '\t' && c != '\r') {
+            return;
+        }
+        actual++;
+    }
+}
+
+/**
+ * Desc: Lanza un error con el archivo, la línea y la columna de la posición actual.
+ * Params:
+ *   - mensaje: Descripción del problema.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Siempre.
+ */
+void LectorInstancia::error(const string& mensaje) const {
+    int columna = static_cast<int>(actual - inicioLinea) + 1;
+    throw runtime_error(nombreArchivo + ":" + to_string(linea) + ":" + to_string(columna) + ": " + mensaje);
+}
+
+/**
+ * Desc: Indica si una posición cierra un dato (espacio, fin de línea o fin del archivo).
+ * Params:
+ *   - pos: Posición justo después del dato convertido.
+ * Returns:
+ *   - bool: True si el dato termina ahí.
+ */
+bool LectorInstancia::terminaDato(const char* pos) const {
+    return pos == fin || *pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n';
+}
+
+/**
+ * Desc: Convierte el siguiente dato como número real (se acepta un signo '+' inicial).
+ *       Si falla, deja la posición al inicio del dato para reportar el error.
+ * Params:
+ *   - valor: Salida con el número leído.
+ * Returns:
+ *   - bool: False si el archivo terminó o el dato no es un número.
+ */
+bool LectorInstancia::convertirReal(double& valor) {
+    saltarEspacios();
+    if (actual == fin) {
+        return false;
+    }
+    const char* inicio = *actual == '+' ? actual + 1 : actual;
+    auto [siguiente, codigo] = from_chars(inicio, fin, valor);
+    if (codigo != errc() || !terminaDato(siguiente)) {
+        return false;
+    }
+    actual = siguiente;
+    return true;
+}
+
+/**
+ * Desc: Lee un entero.
+ * Params:
+ *   - descripcion: Qué dato se espera, para el mensaje de error.
+ * Returns:
+ *   - int: Valor leído.
+ * Throws:
+ *   - runtime_error: Si el archivo termina o el dato no es un entero.
+ */
+int LectorInstancia::leerEntero(const string& descripcion) {
+    saltarEspacios();
+    if (actual == fin) {
+        error("archivo truncado, se esperaba " + descripcion);
+    }
+    int valor;
+    auto [siguiente, codigo] = from_chars(actual, fin, valor);
+    if (codigo != errc() || !terminaDato(siguiente)) {
+        error("se esperaba un entero para " + descripcion);
+    }
+    actual = siguiente;
+    return valor;
+}
+
+/**
+ * Desc: Lee un número real.
+ * Params:
+ *   - descripcion: Qué dato se espera, para el mensaje de error.
+ * Returns:
+ *   - double: Valor leído.
+ * Throws:
+ *   - runtime_error: Si el archivo termina o el dato no es un número.
+ */
+double LectorInstancia::leerReal(const string& descripcion) {
+    double valor;
+    if (!convertirReal(valor)) {
+        error(actual == fin ? "archivo truncado, se esperaba " + descripcion : "se esperaba un número para " + descripcion);
+    }
+    return valor;
+}
+
+/**
+ * Desc: Lee varios números reales seguidos.
+ * Params:
+ *   - destino: Arreglo donde se guardan (cantidad posiciones).
+ *   - cantidad: Números a leer.
+ *   - descripcion: Qué datos se esperan; el error indica además el índice del que falló.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si el archivo termina o algún dato no es un número.
+ */
+void LectorInstancia::leerReales(double* destino, size_t cantidad, const string& descripcion) {
+    for (size_t k = 0; k < cantidad; k++) {
+        if (!convertirReal(destino[k])) {
+            leerReal(descripcion + " [" + to_string(k) + "]");
+        }
+    }
+}
+
+/**
+ * Desc: Verifica que después de los datos solo queden espacios.
+ * Params: void
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si sobran datos al final del archivo.
+ */
+void LectorInstancia::verificarFin() {
+    saltarEspacios();
+    if (actual != fin) {
+        error("datos sobrantes después de la matriz de costos");
+    }
+}
+
+/**
+ * Desc: Indica si queda algún dato antes del fin del archivo (para leer registros
+ *       repetidos hasta agotarlo).
+ * Params: void
+ * Returns:
+ *   - bool: True si después de los espacios queda algo por leer.
+ */
+bool LectorInstancia::quedanDatos() {
+    saltarEspacios();
+    return actual != fin;
+}
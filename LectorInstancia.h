@@ -0,0 +1,35 @@
+#ifndef LECTOR_INSTANCIA_H
+#define LECTOR_INSTANCIA_H
+
+#include <string>
+#include <cstddef>
+
+using namespace std;
+
+// Lector de números sobre el contenido completo de un archivo de texto en memoria.
+// Convierte con from_chars (sin locale ni copias) y lleva la línea y columna
+// actuales para reportar con precisión dónde está un dato faltante o mal formado.
+class LectorInstancia {
+private:
+    const char* actual;
+    const char* fin;
+    const char* inicioLinea;
+    int linea;
+    string nombreArchivo;
+
+    void saltarEspacios();
+    bool terminaDato(const char* pos) const;
+    bool convertirReal(double& valor);
+    [[noreturn]] void error(const string& mensaje) const;
+
+public:
+    LectorInstancia(const char* datos, size_t tamano, const string& nombreArchivo);
+
+    int leerEntero(const string& descripcion);
+    double leerReal(const string& descripcion);
+    void leerReales(double* destino, size_t cantidad, const string& descripcion);
+    void verificarFin();
+    bool quedanDatos();
+};
+
+#endif // LECTOR_INSTANCIA_H
@@ -0,0 +1,374 @@
+#include "ModeloRelajacionLP.h"
+#include <algorithm>
+
+/**
+ * Desc: Constructor por defecto.
+ *       Deja el modelo vacío; debe llamarse a construir() antes de resolver.
+ * Params: void
+ * Returns: void
+ */
+ModeloRelajacionLP::ModeloRelajacionLP() : numClientes(0), numFuentesProd(0), numVarX(0), construido(false) {
+    modelo.setLogLevel(0);
+}
+
+/**
+ * Desc: Arma la matriz CSC de la relajación para las dimensiones y capacidades del
+ *       problema, con los arreglos del tamaño exacto reservados de una vez. Si ya
+ *       corresponde a ese problema (mismas dimensiones), solo reescribe los m
+ *       coeficientes -M_j de las columnas y_j.
+ * Params:
+ *   - problema: Referencia constante al problema a modelar.
+ * Returns: void
+ */
+void EstructuraLP::preparar(const Problema& problema) {
+    int n = problema.getNumClientes();
+    int m = problema.getNumFuentesProd();
+    size_t numVarX = size_t(n) * m;
+    if (n != numClientes || m != numFuentesProd) {
+        numClientes = n;
+        numFuentesProd = m;
+        inicios.assign(numVarX + m + 1, 0);
+        filas.assign(2 * numVarX + m, 0);
+        valores.assign(2 * numVarX + m, 1.0);
+        // Columna x_ij (índice i*m + j): fila de demanda i y fila de capacidad n + j
+        for (size_t k = 0; k < numVarX; ++k) {
+            inicios[k] = CoinBigIndex(2 * k);
+            filas[2 * k] = int(k / m);
+            filas[2 * k + 1] = n + int(k % m);
+        }
+        // Columna y_j: solo la fila de capacidad n + j
+        for (int j = 0; j <= m; ++j) {
+            inicios[numVarX + j] = CoinBigIndex(2 * numVarX + j);
+        }
+        for (int j = 0; j < m; ++j) {
+            filas[2 * numVarX + j] = n + j;
+        }
+    }
+    for (int j = 0; j < m; ++j) {
+        valores[2 * numVarX + j] = -problema.getCapacidad(j);
+    }
+}
+
+/**
+ * Desc: Construye el modelo LP relajado del problema CFL con una matriz armada solo
+ *       para esta llamada. Las estrategias usan la otra versión, con la matriz guardada.
+ * Params:
+ *   - problema: Referencia constante al problema a modelar.
+ * Returns: void
+ */
+void ModeloRelajacionLP::construir(const Problema& problema) {
+    EstructuraLP estructura;
+    estructura.preparar(problema);
+    construir(problema, estructura);
+}
+
+/**
+ * Desc: Construye una única vez el modelo LP relajado del problema CFL.
+ *       Las variables x_ij ocupan las primeras n*m columnas y las y_j las m últimas.
+ *       Restricciones: sum_j x_ij = d_i y sum_i x_ij - M_j y_j <= 0. La matriz llega
+ *       armada en CSC y se carga en Clp con una sola llamada; acá solo se llenan
+ *       cotas, costos y lados derechos. Entre nodos solo cambian los límites de las y_j.
+ * Params:
+ *   - problema: Referencia constante al problema a modelar.
+ *   - estructura: Matriz preparada para este problema con EstructuraLP::preparar().
+ * Returns: void
+ */
+void ModeloRelajacionLP::construir(const Problema& problema, const EstructuraLP& estructura) {
+    numClientes = problema.getNumClientes();
+    numFuentesProd = problema.getNumFuentesProd();
+    numVarX = numClientes * numFuentesProd;
+    int totalVars = numVarX + numFuentesProd;
+
+    vector<double> lower(totalVars, 0.0);
+    vector<double> upper(totalVars, COIN_DBL_MAX);
+    vector<double> objCoeffs(totalVars);
+
+    // Variables y_j (activación): [0, 1]
+    for (int j = 0; j < numFuentesProd; ++j) {
+        upper[numVarX + j] = 1.0;
+        objCoeffs[numVarX + j] = problema.getCostoActivacion(j);
+    }
+    // Variables x_ij (transporte): [0, inf), con la matriz de costos en el mismo orden;
+    // los arcos prohibidos quedan fijos en 0
+    VistaCostos costos = problema.getMatrizCostos();
+    copy(costos.begin(), costos.end(), objCoeffs.begin());
+    for (int i = 0; i < numClientes; ++i) {
+        for (int j = 0; j < numFuentesProd; ++j) {
+            if (!problema.esArcoPermitido(i, j)) {
+                upper[i*numFuentesProd + j] = 0.0;
+            }
+        }
+    }
+
+    vector<double> rowLower(numClientes + numFuentesProd);
+    vector<double> rowUpper(numClientes + numFuentesProd);
+    for (int i = 0; i < numClientes; ++i) {
+        rowLower[i] = rowUpper[i] = problema.getDemanda(i);
+    }
+    for (int j = 0; j < numFuentesProd; ++j) {
+        rowLower[numClientes + j] = -COIN_DBL_MAX;
+        rowUpper[numClientes + j] = 0.0;
+    }
+
+    modelo.loadProblem(totalVars, numClientes + numFuentesProd, estructura.inicios.data(), estructura.filas.data(),
+                       estructura.valores.data(), lower.data(), upper.data(), objCoeffs.data(), rowLower.data(),
+                       rowUpper.data());
+    construido = true;
+}
+
+/**
+ * Desc: Indica si el modelo ya fue construido para algún problema.
+ * Params: void
+ * Returns:
+ *   - bool: True si construir() ya fue llamado.
+ */
+bool ModeloRelajacionLP::estaConstruido() const { return construido; }
+
+/**
+ * Desc: Agrega al modelo, como filas nuevas, los cortes del pool desde el índice dado.
+ *       Las filas nuevas entran con su holgura básica, así que la base actual sigue
+ *       siendo dual factible y el siguiente solve continúa desde ella. Las bases
+ *       guardadas antes de agregar cortes dejan de calzar con el modelo.
+ * Params:
+ *   - pool: Pool de cortes.
+ *   - desde: Primer corte del pool a agregar (los anteriores ya están en el modelo).
+ * Returns: void
+ */
+void ModeloRelajacionLP::agregarCortes(const PoolCortes& pool, int desde) {
+    int numNuevos = pool.numCortes() - desde;
+    if (numNuevos <= 0) {
+        return;
+    }
+    const int* inicios = pool.obtenerInicios();
+    vector<CoinBigIndex> iniciosLocales(numNuevos + 1);
+    for (int k = 0; k <= numNuevos; ++k) {
+        iniciosLocales[k] = inicios[desde + k] - inicios[desde];
+    }
+    modelo.addRows(numNuevos, pool.obtenerLimitesInf() + desde, pool.obtenerLimitesSup() + desde, iniciosLocales.data(),
+                   pool.obtenerIndices() + inicios[desde], pool.obtenerCoeficientes() + inicios[desde]);
+}
+
+/**
+ * Desc: Quita del modelo todas las filas de cortes y deja las de demanda y capacidad.
+ *       El estado de las filas que quedan se conserva para el siguiente solve.
+ * Params: void
+ * Returns: void
+ */
+void ModeloRelajacionLP::quitarCortes() {
+    int numFilasBase = numClientes + numFuentesProd;
+    int numCortes = modelo.numberRows() - numFilasBase;
+    if (numCortes <= 0) {
+        return;
+    }
+    vector<int> filas(numCortes);
+    for (int k = 0; k < numCortes; ++k) {
+        filas[k] = numFilasBase + k;
+    }
+    modelo.deleteRows(numCortes, filas.data());
+}
+
+/**
+ * Desc: Cambia en su lugar el lado derecho de las restricciones de demanda. La base
+ *       actual sigue siendo dual factible, así que el simplex dual continúa desde ella.
+ *       Los cortes pueden dejar de ser válidos; quitarlos antes con quitarCortes().
+ * Params:
+ *   - problema: Problema con las nuevas demandas (mismas dimensiones).
+ * Returns: void
+ */
+void ModeloRelajacionLP::actualizarDemandas(const Problema& problema) {
+    for (int i = 0; i < numClientes; ++i) {
+        modelo.setRowBounds(i, problema.getDemanda(i), problema.getDemanda(i));
+    }
+}
+
+/**
+ * Desc: Cambia en su lugar el costo de las variables y_j. La región factible no
+ *       cambia, así que los cortes siguen siendo válidos y la base primal factible.
+ * Params:
+ *   - problema: Problema con los nuevos costos de activación (mismas dimensiones).
+ * Returns: void
+ */
+void ModeloRelajacionLP::actualizarCostosActivacion(const Problema& problema) {
+    for (int j = 0; j < numFuentesProd; ++j) {
+        modelo.setObjectiveCoefficient(numVarX + j, problema.getCostoActivacion(j));
+    }
+}
+
+/**
+ * Desc: Deja cargada una base guardada para que el siguiente solve parta de ella.
+ * Params:
+ *   - base: Estado de columnas y filas; se ignora si no calza con el modelo actual.
+ * Returns: void
+ */
+void ModeloRelajacionLP::cargarBase(const vector<unsigned char>& base) {
+    if (base.size() == tamanoBase()) {
+        modelo.copyinStatus(base.data());
+    }
+}
+
+/**
+ * Desc: Resuelve la relajación LP para un conjunto de variables fijadas.
+ *       Solo actualiza los límites de las columnas y_j y, si se entrega una base
+ *       (típicamente la del nodo padre), arranca el simplex dual desde ella.
+ * Params:
+ *   - fijadas: Mapa de variables y_j fijadas a 0 o 1.
+ *   - baseInicial: Estado de columnas y filas guardado por un solve anterior (puede ir vacío).
+ * Returns:
+ *   - bool: True si la relajación es factible y se resolvió a optimalidad.
+ */
+bool ModeloRelajacionLP::resolver(const map<int, int>& fijadas, const vector<unsigned char>& baseInicial) {
+    for (int j = 0; j < numFuentesProd; ++j) {
+        modelo.setColumnBounds(numVarX + j, 0.0, 1.0);
+    }
+    for (const auto& [j, valor] : fijadas) {
+        modelo.setColumnBounds(numVarX + j, valor, valor);
+    }
+    return resolverDesde(baseInicial.size() == tamanoBase() ? baseInicial.data() : nullptr);
+}
+
+/**
+ * Desc: Resuelve la relajación LP para las variables fijadas de un nodo compacto.
+ * Params:
+ *   - nodo: Nodo con los conjuntos de variables fijadas a 0 y a 1.
+ *   - baseInicial: Base desde la cual reanudar el simplex dual (nullptr para partir en frío).
+ * Returns:
+ *   - bool: True si la relajación es factible y se resolvió a optimalidad.
+ */
+bool ModeloRelajacionLP::resolver(const NodoCompacto& nodo, const unsigned char* baseInicial) {
+    const uint64_t* cero = nodo.fijadasCero();
+    const uint64_t* uno = nodo.fijadasUno();
+    for (int j = 0; j < numFuentesProd; ++j) {
+        uint64_t bit = uint64_t(1) << (j % 64);
+        if (cero[j / 64] & bit) {
+            modelo.setColumnBounds(numVarX + j, 0.0, 0.0);
+        } else if (uno[j / 64] & bit) {
+            modelo.setColumnBounds(numVarX + j, 1.0, 1.0);
+        } else {
+            modelo.setColumnBounds(numVarX + j, 0.0, 1.0);
+        }
+    }
+    return resolverDesde(baseInicial);
+}
+
+/**
+ * Desc: Evalúa una rama sin crear el nodo: fija y_var al valor pedido, reanuda el
+ *       simplex dual desde la base entregada con un límite de iteraciones y luego
+ *       devuelve la variable a [0, 1]. Como el dual se mantiene factible, el objetivo
+ *       al cortar por iteraciones sigue siendo una cota inferior válida de la rama.
+ *       La variable debe estar libre en el nodo que se está ramificando.
+ * Params:
+ *   - var: Índice de la variable y_j a fijar.
+ *   - valor: Valor de la rama (0 o 1).
+ *   - base: Base del nodo que se ramifica.
+ *   - maxIterSimplex: Máximo de iteraciones del simplex dual.
+ * Returns:
+ *   - double: Cota inferior de la rama, o COIN_DBL_MAX si es infactible.
+ */
+double ModeloRelajacionLP::resolverTentativo(int var, int valor, const unsigned char* base, int maxIterSimplex) {
+    modelo.setColumnBounds(numVarX + var, valor, valor);
+    modelo.setMaximumIterations(maxIterSimplex);
+    resolverDesde(base);
+    double cota = modelo.status() == 1 ? COIN_DBL_MAX : modelo.objectiveValue();
+    modelo.setMaximumIterations(INT_MAX);
+    modelo.setColumnBounds(numVarX + var, 0.0, 1.0);
+    return cota;
+}
+
+/**
+ * Desc: Lanza el simplex dual con los límites ya cargados, partiendo de la base
+ *       entregada si la hay.
+ * Params:
+ *   - baseInicial: Estado de columnas y filas (nullptr para partir de la base actual).
+ * Returns:
+ *   - bool: True si la relajación es factible y se resolvió a optimalidad.
+ */
+bool ModeloRelajacionLP::resolverDesde(const unsigned char* baseInicial) {
+    if (baseInicial) {
+        modelo.copyinStatus(baseInicial);
+    }
+    modelo.dual();
+    return modelo.status() == 0;
+}
+
+/**
+ * Desc: Devuelve el valor objetivo del último solve.
+ * Params: void
+ * Returns:
+ *   - double: Cota inferior entregada por la relajación.
+ */
+double ModeloRelajacionLP::obtenerValorObjetivo() const { return modelo.objectiveValue(); }
+
+/**
+ * Desc: Extrae los valores de las variables y_j del último solve.
+ * Params: void
+ * Returns:
+ *   - vector<double>: Valores de activación de cada fuente.
+ */
+vector<double> ModeloRelajacionLP::obtenerSolucionY() const {
+    const double* solucion = modelo.primalColumnSolution();
+    return vector<double>(solucion + numVarX, solucion + numVarX + numFuentesProd);
+}
+
+/**
+ * Desc: Devuelve las variables y_j del último solve sin copiarlas.
+ * Params: void
+ * Returns:
+ *   - const double*: Puntero a los numFuentesProd valores de activación.
+ */
+const double* ModeloRelajacionLP::obtenerValoresY() const { return modelo.primalColumnSolution() + numVarX; }
+
+/**
+ * Desc: Devuelve las variables x_ij del último solve sin copiarlas, en orden
+ *       fila por cliente (x_ij en la posición i*numFuentesProd + j).
+ * Params: void
+ * Returns:
+ *   - const double*: Puntero a los numClientes*numFuentesProd valores de transporte.
+ */
+const double* ModeloRelajacionLP::obtenerValoresX() const { return modelo.primalColumnSolution(); }
+
+/**
+ * Desc: Devuelve los costos reducidos de las variables y_j del último solve, sin
+ *       copiarlos. En una y_j en su cota inferior el costo reducido es >= 0 y en la
+ *       superior, <= 0: es lo que sube la cota como mínimo si se la mueve a la otra.
+ * Params: void
+ * Returns:
+ *   - const double*: Puntero a los numFuentesProd costos reducidos.
+ */
+const double* ModeloRelajacionLP::obtenerCostosReducidosY() const { return modelo.dualColumnSolution() + numVarX; }
+
+/**
+ * Desc: Copia el estado de la base (columnas y filas) del último solve,
+ *       para poder reanudar el simplex dual desde ella en los nodos hijos.
+ * Params: void
+ * Returns:
+ *   - vector<unsigned char>: Estado de la base en el formato de Clp.
+ */
+vector<unsigned char> ModeloRelajacionLP::obtenerBase() const {
+    const unsigned char* estado = modelo.statusArray();
+    return vector<unsigned char>(estado, estado + modelo.numberColumns() + modelo.numberRows());
+}
+
+/**
+ * Desc: Devuelve el número de iteraciones simplex del último solve.
+ * Params: void
+ * Returns:
+ *   - int: Iteraciones del simplex dual.
+ */
+int ModeloRelajacionLP::obtenerIteraciones() const { return modelo.numberIterations(); }
+
+/**
+ * Desc: Devuelve el estado de la base del último solve sin copiarlo.
+ *       El puntero deja de ser válido en el siguiente solve.
+ * Params: void
+ * Returns:
+ *   - const unsigned char*: Estado de columnas y filas en el formato de Clp.
+ */
+const unsigned char* ModeloRelajacionLP::obtenerEstadoBase() const { return modelo.statusArray(); }
+
+/**
+ * Desc: Devuelve cuántos bytes ocupa una base del modelo (columnas + filas).
+ * Params: void
+ * Returns:
+ *   - size_t: Tamaño de la base.
+ */
+size_t ModeloRelajacionLP::tamanoBase() const { return modelo.numberColumns() + modelo.numberRows(); }
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef MODELO_RELAJACION_LP_H
+#define MODELO_RELAJACION_LP_H
+
+#include "Problema.h"
+#include "NodoCompacto.h"
+#include "PoolCortes.h"
+#include <coin/ClpSimplex.hpp>
+#include <vector>
+#include <map>
+#include <climits>
+
+using namespace std;
+
+// Matriz de restricciones de la relajación en formato CSC (por columnas), lista para
+// pasarla a Clp de una vez: cada x_ij tiene un 1 en la fila de demanda i y otro en la
+// de capacidad j, y cada y_j un -M_j en la de capacidad j, 2nm + m elementos en total.
+// Solo depende de las dimensiones y las capacidades, así que la estrategia la guarda
+// y la reutiliza entre resoluciones y entre los modelos de sus hilos.
+struct EstructuraLP {
+    int numClientes = 0;
+    int numFuentesProd = 0;
+    vector<CoinBigIndex> inicios;
+    vector<int> filas;
+    vector<double> valores;
+
+    void preparar(const Problema& problema);
+};
+
+class ModeloRelajacionLP {
+private:
+    ClpSimplex modelo;
+    int numClientes;
+    int numFuentesProd;
+    int numVarX;
+    bool construido;
+
+    bool resolverDesde(const unsigned char* baseInicial);
+
+public:
+    ModeloRelajacionLP();
+
+    void construir(const Problema& problema);
+    void construir(const Problema& problema, const EstructuraLP& estructura);
+    bool estaConstruido() const;
+    void agregarCortes(const PoolCortes& pool, int desde = 0);
+    void quitarCortes();
+    void actualizarDemandas(const Problema& problema);
+    void actualizarCostosActivacion(const Problema& problema);
+    void cargarBase(const vector<unsigned char>& base);
+
+    bool resolver(const map<int, int>& fijadas, const vector<unsigned char>& baseInicial);
+    bool resolver(const NodoCompacto& nodo, const unsigned char* baseInicial);
+    double resolverTentativo(int var, int valor, const unsigned char* base, int maxIterSimplex);
+
+    double obtenerValorObjetivo() const;
+    vector<double> obtenerSolucionY() const;
+    const double* obtenerValoresY() const;
+    const double* obtenerValoresX() const;
+    const double* obtenerCostosReducidosY() const;
+    vector<unsigned char> obtenerBase() const;
+    const unsigned char* obtenerEstadoBase() const;
+    size_t tamanoBase() const;
+    int obtenerIteraciones() const;
+};
+
+#endif // MODELO_RELAJACION_LP_H
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "NodoCompacto.h"
+#include <cmath>
+
+/**
+ * Desc: Devuelve el conjunto de bits de las variables fijadas a 0.
+ * Params: void
+ * Returns:
+ *   - uint64_t*: Puntero a las numPalabras palabras del conjunto.
+ */
+uint64_t* NodoCompacto::fijadasCero() { return reinterpret_cast<uint64_t*>(this + 1); }
+
+/**
+ * Desc: Devuelve el conjunto de bits de las variables fijadas a 1.
+ * Params: void
+ * Returns:
+ *   - uint64_t*: Puntero a las numPalabras palabras del conjunto.
+ */
+uint64_t* NodoCompacto::fijadasUno() { return fijadasCero() + numPalabras; }
+
+const uint64_t* NodoCompacto::fijadasCero() const { return reinterpret_cast<const uint64_t*>(this + 1); }
+
+const uint64_t* NodoCompacto::fijadasUno() const { return fijadasCero() + numPalabras; }
+
+/**
+ * Desc: Fija una variable y_j a 0 o 1 en este nodo.
+ * Params:
+ *   - var: Índice de la variable a fijar.
+ *   - valor: Valor asignado (0 o 1).
+ * Returns: void
+ */
+void NodoCompacto::fijarVariable(int var, int valor) {
+    uint64_t bit = uint64_t(1) << (var % 64);
+    if (valor == 0) {
+        fijadasCero()[var / 64] |= bit;
+        fijadasUno()[var / 64] &= ~bit;
+    } else {
+        fijadasUno()[var / 64] |= bit;
+        fijadasCero()[var / 64] &= ~bit;
+    }
+}
+
+/**
+ * Desc: Indica si una variable ya está fijada en este nodo.
+ * Params:
+ *   - var: Índice de la variable.
+ * Returns:
+ *   - bool: True si está fijada a 0 o a 1.
+ */
+bool NodoCompacto::estaFijada(int var) const {
+    uint64_t bit = uint64_t(1) << (var % 64);
+    return ((fijadasCero()[var / 64] | fijadasUno()[var / 64]) & bit) != 0;
+}
+
+/**
+ * Desc: Cuenta las variables fijadas en este nodo.
+ * Params: void
+ * Returns:
+ *   - int: Número de variables fijadas a 0 o a 1.
+ */
+int NodoCompacto::numFijadas() const {
+    int total = 0;
+    for (int w = 0; w < numPalabras; w++) {
+        total += __builtin_popcountll(fijadasCero()[w] | fijadasUno()[w]);
+    }
+    return total;
+}
+
+/**
+ * Desc: Guarda la cota inferior en precisión simple redondeando hacia abajo,
+ *       para que la cota almacenada nunca supere la real y la poda siga siendo válida.
+ * Params:
+ *   - cota: Cota inferior calculada en doble precisión.
+ * Returns: void
+ */
+void NodoCompacto::establecerCotaInferior(double cota) {
+    cotaInferior = static_cast<float>(cota);
+    if (cotaInferior > cota) {
+        cotaInferior = nextafterf(cotaInferior, -INFINITY);
+    }
+}
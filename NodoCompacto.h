@@ -0,0 +1,34 @@
+#ifndef NODO_COMPACTO_H
+#define NODO_COMPACTO_H
+
+#include <cstdint>
+
+using namespace std;
+
+// Nodo del árbol de búsqueda en formato compacto. Las variables fijadas se
+// guardan como dos conjuntos de bits (fijadas a 0 y fijadas a 1) que van
+// justo después de la cabecera, en la memoria reservada por ArenaNodos.
+struct NodoCompacto {
+    float cotaInferior;
+    float estimacion;
+    int32_t profundidad;
+    int32_t varRamificacion;  // -1 si aún no se elige
+    float valorRamificacion;  // valor LP de esa variable, para aprender pseudo-costos
+    int32_t idxBase;          // índice en AlmacenBases, -1 si no tiene base
+    int32_t numPalabras;      // palabras de 64 bits por conjunto
+    int32_t relleno;          // mantiene alineados los conjuntos de bits
+
+    uint64_t* fijadasCero();
+    uint64_t* fijadasUno();
+    const uint64_t* fijadasCero() const;
+    const uint64_t* fijadasUno() const;
+
+    void fijarVariable(int var, int valor);
+    bool estaFijada(int var) const;
+    int numFijadas() const;
+    void establecerCotaInferior(double cota);
+};
+
+static_assert(sizeof(NodoCompacto) % sizeof(uint64_t) == 0, "La cabecera debe dejar alineados los conjuntos de bits");
+
+#endif // NODO_COMPACTO_H
@@ -0,0 +1,75 @@
+#include "PoolCortes.h"
+#include <algorithm>
+
+/**
+ * Desc: Constructor del pool de cortes. Queda vacío.
+ * Params: void
+ * Returns: void
+ */
+PoolCortes::PoolCortes() : inicios(1, 0) {}
+
+/**
+ * Desc: Agrega un corte limInf <= sum coef[k] * col[idx[k]] <= limSup al final del pool.
+ * Params:
+ *   - tipo: Familia del corte (solo para estadísticas).
+ *   - idx: Columnas del modelo con coeficiente no nulo.
+ *   - coef: Coeficientes, en el mismo orden que idx.
+ *   - limInf: Límite inferior de la fila (-COIN_DBL_MAX si no tiene).
+ *   - limSup: Límite superior de la fila (COIN_DBL_MAX si no tiene).
+ * Returns: void
+ */
+void PoolCortes::agregar(TipoCorte tipo, const vector<int>& idx, const vector<double>& coef, double limInf, double limSup) {
+    indices.insert(indices.end(), idx.begin(), idx.end());
+    coeficientes.insert(coeficientes.end(), coef.begin(), coef.end());
+    inicios.push_back(indices.size());
+    limitesInf.push_back(limInf);
+    limitesSup.push_back(limSup);
+    tipos.push_back(tipo);
+}
+
+/**
+ * Desc: Elimina todos los cortes, para reutilizar el pool en otra resolución.
+ * Params: void
+ * Returns: void
+ */
+void PoolCortes::vaciar() {
+    inicios.assign(1, 0);
+    indices.clear();
+    coeficientes.clear();
+    limitesInf.clear();
+    limitesSup.clear();
+    tipos.clear();
+}
+
+/**
+ * Desc: Devuelve el número de cortes del pool.
+ * Params: void
+ * Returns:
+ *   - int: Cantidad de cortes.
+ */
+int PoolCortes::numCortes() const { return tipos.size(); }
+
+/**
+ * Desc: Cuenta los cortes de una familia.
+ * Params:
+ *   - tipo: Familia a contar.
+ * Returns:
+ *   - int: Cantidad de cortes de esa familia.
+ */
+int PoolCortes::contar(TipoCorte tipo) const { return count(tipos.begin(), tipos.end(), tipo); }
+
+/**
+ * Desc: Devuelve los inicios de cada corte (numCortes() + 1 entradas).
+ * Params: void
+ * Returns:
+ *   - const int*: Posición del primer coeficiente de cada corte.
+ */
+const int* PoolCortes::obtenerInicios() const { return inicios.data(); }
+
+const int* PoolCortes::obtenerIndices() const { return indices.data(); }
+
+const double* PoolCortes::obtenerCoeficientes() const { return coeficientes.data(); }
+
+const double* PoolCortes::obtenerLimitesInf() const { return limitesInf.data(); }
+
+const double* PoolCortes::obtenerLimitesSup() const { return limitesSup.data(); }
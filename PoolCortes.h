@@ -0,0 +1,41 @@
+#ifndef POOL_CORTES_H
+#define POOL_CORTES_H
+
+#include <vector>
+
+using namespace std;
+
+enum TipoCorte {
+    CORTE_COTA_VARIABLE,   // x_ij <= min(d_i, M_j) y_j
+    CORTE_COBERTURA,       // cobertura de mochila sobre la capacidad total
+    CORTE_COBERTURA_FLUJO  // cobertura de flujo sobre la capacidad total
+};
+
+// Cortes separados en la raíz, guardados por filas (formato CSR) con los índices
+// de columna del ModeloRelajacionLP. Los hilos cargan el mismo pool en su modelo
+// para que las bases guardadas sirvan en todos ellos.
+class PoolCortes {
+private:
+    vector<int> inicios;  // inicio de cada corte en indices/coeficientes, más uno al final
+    vector<int> indices;
+    vector<double> coeficientes;
+    vector<double> limitesInf;
+    vector<double> limitesSup;
+    vector<TipoCorte> tipos;
+
+public:
+    PoolCortes();
+
+    void agregar(TipoCorte tipo, const vector<int>& idx, const vector<double>& coef, double limInf, double limSup);
+    void vaciar();
+
+    int numCortes() const;
+    int contar(TipoCorte tipo) const;
+    const int* obtenerInicios() const;
+    const int* obtenerIndices() const;
+    const double* obtenerCoeficientes() const;
+    const double* obtenerLimitesInf() const;
+    const double* obtenerLimitesSup() const;
+};
+
+#endif // POOL_CORTES_H
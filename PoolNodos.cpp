@@ -0,0 +1,247 @@
+#include "PoolNodos.h"
+
+/**
+ * Desc: Constructor del pool de nodos abiertos.
+ *       Cada trabajador tiene una cola local (deque) donde deja sus hijos, y todos
+ *       comparten un heap global ordenado según la política de selección.
+ *       La política también define cuántos nodos se guardan localmente antes de
+ *       pasarlos al heap: ninguno en mejor primero, muchos en profundidad primero
+ *       (menos memoria) y unos pocos en mejor estimación (zambullidas cortas).
+ * Params:
+ *   - numTrabajadores: Número de hilos que usarán el pool (1 para la versión serial).
+ *   - politica: Política de selección de nodos.
+ * Returns: void
+ */
+PoolNodos::PoolNodos(int numTrabajadores, PoliticaSeleccion politica)
+    : comparador(politica), numNodos(0) {
+    for (int t = 0; t < max(1, numTrabajadores); t++) {
+        colasLocales.push_back(make_unique<ColaLocal>());
+    }
+    switch (politica) {
+        case PROFUNDIDAD_PRIMERO: limiteLocal = 1024; break;
+        case MEJOR_ESTIMACION:    limiteLocal = 2;    break;
+        case MEJOR_PRIMERO:
+        default:                  limiteLocal = 0;    break;
+    }
+}
+
+/**
+ * Desc: Inserta un nodo abierto en la cola local del trabajador.
+ *       Si la cola local supera su límite, su nodo más antiguo pasa al heap global,
+ *       donde queda disponible para todos los hilos.
+ * Params:
+ *   - trabajador: Índice del hilo que inserta.
+ *   - nodo: Nodo a insertar.
+ * Returns: void
+ */
+void PoolNodos::insertar(int trabajador, NodoCompacto* nodo) {
+    numNodos++;
+    if (limiteLocal == 0) {
+        insertarGlobal(nodo);
+        return;
+    }
+
+    NodoCompacto* desborde = nullptr;
+    {
+        ColaLocal& local = *colasLocales[trabajador];
+        lock_guard<mutex> lock(local.mtx);
+        local.nodos.push_back(nodo);
+        if (local.nodos.size() > limiteLocal) {
+            desborde = local.nodos.front();
+            local.nodos.pop_front();
+        }
+    }
+    if (desborde) {
+        insertarGlobal(desborde);
+    }
+}
+
+/**
+ * Desc: Extrae el siguiente nodo a procesar por un trabajador.
+ *       Orden de búsqueda: su cola local (el último insertado), el heap global
+ *       y, si ambos están vacíos, roba el nodo más antiguo de otro trabajador.
+ * Params:
+ *   - trabajador: Índice del hilo que extrae.
+ * Returns:
+ *   - NodoCompacto*: Nodo extraído, o nullptr si no hay nodos disponibles.
+ */
+NodoCompacto* PoolNodos::extraer(int trabajador) {
+    NodoCompacto* nodo = nullptr;
+    {
+        ColaLocal& local = *colasLocales[trabajador];
+        lock_guard<mutex> lock(local.mtx);
+        if (!local.nodos.empty()) {
+            nodo = local.nodos.back();
+            local.nodos.pop_back();
+        }
+    }
+    if (!nodo) {
+        nodo = extraerGlobal();
+    }
+    if (!nodo) {
+        nodo = robar(trabajador);
+    }
+    if (nodo) {
+        numNodos--;
+    }
+    return nodo;
+}
+
+/**
+ * Desc: Inserta un nodo en el heap global.
+ * Params:
+ *   - nodo: Nodo a insertar.
+ * Returns: void
+ */
+void PoolNodos::insertarGlobal(NodoCompacto* nodo) {
+    lock_guard<mutex> lock(mtxGlobal);
+    heapGlobal.push_back(nodo);
+    push_heap(heapGlobal.begin(), heapGlobal.end(), comparador);
+}
+
+/**
+ * Desc: Extrae el mejor nodo del heap global según la política.
+ * Params: void
+ * Returns:
+ *   - NodoCompacto*: Nodo extraído, o nullptr si el heap está vacío.
+ */
+NodoCompacto* PoolNodos::extraerGlobal() {
+    lock_guard<mutex> lock(mtxGlobal);
+    if (heapGlobal.empty()) {
+        return nullptr;
+    }
+    pop_heap(heapGlobal.begin(), heapGlobal.end(), comparador);
+    auto nodo = heapGlobal.back();
+    heapGlobal.pop_back();
+    return nodo;
+}
+
+/**
+ * Desc: Roba el nodo más antiguo (el menos profundo) de la cola local de otro trabajador.
+ * Params:
+ *   - trabajador: Índice del hilo que roba.
+ * Returns:
+ *   - NodoCompacto*: Nodo robado, o nullptr si todas las colas están vacías.
+ */
+NodoCompacto* PoolNodos::robar(int trabajador) {
+    int n = colasLocales.size();
+    for (int k = 1; k < n; k++) {
+        ColaLocal& victima = *colasLocales[(trabajador + k) % n];
+        lock_guard<mutex> lock(victima.mtx);
+        if (!victima.nodos.empty()) {
+            auto nodo = victima.nodos.front();
+            victima.nodos.pop_front();
+            return nodo;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Desc: Indica si no quedan nodos abiertos en el pool.
+ * Params: void
+ * Returns:
+ *   - bool: True si el pool está vacío.
+ */
+bool PoolNodos::vacio() const { return numNodos == 0; }
+
+/**
+ * Desc: Devuelve el número de nodos abiertos en el pool.
+ * Params: void
+ * Returns:
+ *   - size_t: Número de nodos.
+ */
+size_t PoolNodos::tamano() const { return numNodos; }
+
+/**
+ * Desc: Calcula la menor cota inferior entre todos los nodos abiertos (cota global).
+ *       Con mejor primero es el tope del heap; con otras políticas recorre el pool.
+ * Params: void
+ * Returns:
+ *   - double: Menor cota inferior, o 1e20 si el pool está vacío.
+ */
+double PoolNodos::mejorCotaInferior() const {
+    double mejor = 1e20;
+    {
+        lock_guard<mutex> lock(mtxGlobal);
+        if (comparador.obtenerPolitica() == MEJOR_PRIMERO) {
+            return heapGlobal.empty() ? mejor : heapGlobal.front()->cotaInferior;
+        }
+        for (const auto& nodo : heapGlobal) {
+            mejor = min<double>(mejor, nodo->cotaInferior);
+        }
+    }
+    for (const auto& local : colasLocales) {
+        lock_guard<mutex> lock(local->mtx);
+        for (const auto& nodo : local->nodos) {
+            mejor = min<double>(mejor, nodo->cotaInferior);
+        }
+    }
+    return mejor;
+}
+
+/**
+ * Desc: Elimina del pool los nodos cuya cota inferior supera la cota superior dada.
+ *       Los nodos no se liberan aquí: se devuelven para que el llamador los
+ *       regrese a su arena.
+ * Params:
+ *   - cotaSup: Cota superior actual (mejor solución encontrada hasta ahora).
+ * Returns:
+ *   - vector<NodoCompacto*>: Nodos eliminados.
+ */
+vector<NodoCompacto*> PoolNodos::podar(double cotaSup) {
+    auto peor = [cotaSup](const NodoCompacto* nodo) { return nodo->cotaInferior > cotaSup; };
+    vector<NodoCompacto*> eliminados;
+    {
+        lock_guard<mutex> lock(mtxGlobal);
+        auto corte = partition(heapGlobal.begin(), heapGlobal.end(), [&](const NodoCompacto* nodo) { return !peor(nodo); });
+        eliminados.insert(eliminados.end(), corte, heapGlobal.end());
+        heapGlobal.erase(corte, heapGlobal.end());
+        make_heap(heapGlobal.begin(), heapGlobal.end(), comparador);
+    }
+    for (auto& local : colasLocales) {
+        lock_guard<mutex> lock(local->mtx);
+        auto corte = stable_partition(local->nodos.begin(), local->nodos.end(), [&](const NodoCompacto* nodo) { return !peor(nodo); });
+        eliminados.insert(eliminados.end(), corte, local->nodos.end());
+        local->nodos.erase(corte, local->nodos.end());
+    }
+    numNodos -= eliminados.size();
+    return eliminados;
+}
+
+/**
+ * Desc: Vacía el pool por completo.
+ * Params: void
+ * Returns:
+ *   - vector<NodoCompacto*>: Nodos que quedaban en el pool.
+ */
+vector<NodoCompacto*> PoolNodos::limpiar() {
+    vector<NodoCompacto*> restantes;
+    {
+        lock_guard<mutex> lock(mtxGlobal);
+        restantes.swap(heapGlobal);
+    }
+    for (auto& local : colasLocales) {
+        lock_guard<mutex> lock(local->mtx);
+        restantes.insert(restantes.end(), local->nodos.begin(), local->nodos.end());
+        local->nodos.clear();
+    }
+    numNodos = 0;
+    return restantes;
+}
+
+/**
+ * Desc: Devuelve el número de trabajadores (colas locales) del pool.
+ * Params: void
+ * Returns:
+ *   - int: Número de trabajadores.
+ */
+int PoolNodos::obtenerNumTrabajadores() const { return colasLocales.size(); }
+
+/**
+ * Desc: Devuelve la política de selección del pool.
+ * Params: void
+ * Returns:
+ *   - PoliticaSeleccion: Política configurada.
+ */
+PoliticaSeleccion PoolNodos::obtenerPolitica() const { return comparador.obtenerPolitica(); }
@@ -0,0 +1,49 @@
+#ifndef POOL_NODOS_H
+#define POOL_NODOS_H
+
+#include "NodoCompacto.h"
+#include "ComparadorNodos.h"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+using namespace std;
+
+class PoolNodos {
+private:
+    struct ColaLocal {
+        mutex mtx;
+        deque<NodoCompacto*> nodos;
+    };
+
+    vector<unique_ptr<ColaLocal>> colasLocales;
+    mutable mutex mtxGlobal;
+    vector<NodoCompacto*> heapGlobal;
+    ComparadorNodos comparador;
+    size_t limiteLocal;
+    atomic<size_t> numNodos;
+
+    void insertarGlobal(NodoCompacto* nodo);
+    NodoCompacto* extraerGlobal();
+    NodoCompacto* robar(int trabajador);
+
+public:
+    PoolNodos(int numTrabajadores, PoliticaSeleccion politica = MEJOR_PRIMERO);
+
+    void insertar(int trabajador, NodoCompacto* nodo);
+    NodoCompacto* extraer(int trabajador);
+
+    bool vacio() const;
+    size_t tamano() const;
+    double mejorCotaInferior() const;
+    vector<NodoCompacto*> podar(double cotaSup);
+    vector<NodoCompacto*> limpiar();
+
+    int obtenerNumTrabajadores() const;
+    PoliticaSeleccion obtenerPolitica() const;
+};
+
+#endif // POOL_NODOS_H
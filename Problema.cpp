@@ -1,71 +1,250 @@
 #include "Problema.h"
+#include "ArchivoMapeado.h"
+#include "LectorInstancia.h"
+#include <cstring>
+#include <algorithm>
+#include <charconv>
+
+static const char MAGIA_BINARIA[4] = {'C', 'F', 'L', 'B'};
+static const uint32_t VERSION_BINARIA = 1;
+static const size_t ALINEACION_COSTOS = 64;
 
 /**
  * Desc: Constructor que carga los datos del problema desde un archivo.
  *       Inicializa estructuras como matrices de costos, capacidades y demandas.
+ *       Acepta el formato de texto y el binario (se reconoce por su cabecera).
  * Params:
  *   - nombreArchivo: Nombre del archivo de entrada con los datos del problema.
  * Returns: void
  */
-Problema::Problema(const string& nombreArchivo) {
+Problema::Problema(const string& nombreArchivo) : transpuesta(make_shared<MatrizTranspuesta>()) {
+    if (esArchivoBinario(nombreArchivo)) {
+        cargarBinario(nombreArchivo);
+    } else {
+        cargarTexto(nombreArchivo);
+    }
+}
 
-    // cout << "[Problema::Problema] Cargando problema desde: " << nombreArchivo << "\n";
-    ifstream archivo(nombreArchivo);
-    if (!archivo.is_open()) {
-        throw runtime_error("No se pudo abrir el archivo: " + nombreArchivo);
+/**
+ * Desc: Constructor que arma el problema desde datos en memoria (por ejemplo, una
+ *       instancia reducida o generada). Copia los costos a un arreglo alineado.
+ * Params:
+ *   - capacidades: M[j] de cada fuente.
+ *   - costosActivacion: f[j] de cada fuente.
+ *   - demandas: d[i] de cada cliente.
+ *   - costos: c[i][j] en orden fila por cliente (numClientes * numFuentesProd).
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si las dimensiones no son positivas o no calzan entre sí.
+ */
+Problema::Problema(const vector<double>& capacidades, const vector<double>& costosActivacion, const vector<double>& demandas,
+                   const vector<double>& costos)
+    : numClientes(demandas.size()), numFuentesProd(capacidades.size()), transpuesta(make_shared<MatrizTranspuesta>()),
+      costosFuenteProd(costosActivacion), demandasClientes(demandas), capacidadesFuenteProd(capacidades) {
+    if (numFuentesProd <= 0 || numClientes <= 0 || costosActivacion.size() != capacidades.size() ||
+        costos.size() != size_t(numClientes) * numFuentesProd) {
+        throw runtime_error("Dimensiones inconsistentes al armar el problema");
     }
+    shared_ptr<double> buffer = reservarAlineado(costos.size());
+    copy(costos.begin(), costos.end(), buffer.get());
+    matrizCostos = buffer;
+}
+
+/**
+ * Desc: Indica si un archivo está en el formato binario, mirando su cabecera.
+ * Params:
+ *   - nombreArchivo: Ruta del archivo.
+ * Returns:
+ *   - bool: True si el archivo empieza con la marca del formato binario.
+ */
+bool Problema::esArchivoBinario(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo, ios::binary);
+    char magia[4];
+    return archivo.read(magia, sizeof(magia)) && memcmp(magia, MAGIA_BINARIA, sizeof(magia)) == 0;
+}
+
+/**
+ * Desc: Carga el problema desde el formato de texto.
+ *       Proyecta el archivo completo en memoria y convierte los números en su lugar
+ *       con LectorInstancia, sin el flujo con locale de ifstream.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo de texto.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si el archivo no se puede abrir, está truncado o tiene datos
+ *                    mal formados (el mensaje indica línea y columna).
+ */
+void Problema::cargarTexto(const string& nombreArchivo) {
+    ArchivoMapeado archivo(nombreArchivo);
+    LectorInstancia lector(reinterpret_cast<const char*>(archivo.obtenerDatos()), archivo.obtenerTamano(), nombreArchivo);
 
     // Leer número de fuentes y clientes
-    archivo >> numFuentesProd >> numClientes;
-    // cout << "[Problema::Problema] Fuentes: " << numFuentesProd << ", Clientes: " << numClientes << "\n";
+    numFuentesProd = lector.leerEntero("el número de fuentes");
+    numClientes = lector.leerEntero("el número de clientes");
+    if (numFuentesProd <= 0 || numClientes <= 0) {
+        throw runtime_error(nombreArchivo + ": las dimensiones deben ser positivas");
+    }
 
     // Inicializar matrices
-    matrizCostos.resize(numClientes, vector<double>(numFuentesProd));
+    shared_ptr<double> buffer = reservarAlineado(size_t(numClientes) * numFuentesProd);
+    double* costos = buffer.get();
+    matrizCostos = buffer;
     costosFuenteProd.resize(numFuentesProd);
     demandasClientes.resize(numClientes);
     capacidadesFuenteProd.resize(numFuentesProd);
 
-    // Leer capacidades de fuentes
-    for (int j = 0; j < numFuentesProd; j++) {
-        archivo >> capacidadesFuenteProd[j];
-    }
+    // Capacidades y costos de activación de fuentes, demandas de clientes
+    lector.leerReales(capacidadesFuenteProd.data(), numFuentesProd, "capacidad de fuente");
+    lector.leerReales(costosFuenteProd.data(), numFuentesProd, "costo de activación de fuente");
+    lector.leerReales(demandasClientes.data(), numClientes, "demanda de cliente");
 
-    // cout << "[Problema::Problema] Capacidades: ";
-    // for (int j = 0; j < numFuentesProd; j++) {
-    //     cout << capacidadesFuenteProd[j] << " ";
-    // }
-    // cout << "\n";
+    // Matriz de costos de envío, fila por cliente
+    for (int i = 0; i < numClientes; i++) {
+        lector.leerReales(costos + size_t(i) * numFuentesProd, numFuentesProd,
+                          "costo de envío del cliente " + to_string(i) + " a la fuente");
+    }
+    lector.verificarFin();
+}
 
-    // Leer costos de activación
-    for (int j = 0; j < numFuentesProd; j++) {
-        archivo >> costosFuenteProd[j];
+/**
+ * Desc: Carga el problema desde el formato binario proyectando el archivo en memoria.
+ *       Capacidades, costos de activación y demandas (O(n + m)) se copian; la matriz
+ *       de costos (O(n * m)) se usa en su lugar y el mapeo vive mientras alguna copia
+ *       del problema la use.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo binario.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si la cabecera no es válida o el archivo está truncado.
+ */
+void Problema::cargarBinario(const string& nombreArchivo) {
+    auto archivo = make_shared<ArchivoMapeado>(nombreArchivo);
+    const unsigned char* datos = archivo->obtenerDatos();
+    size_t tamano = archivo->obtenerTamano();
+    if (tamano < sizeof(CabeceraBinaria)) {
+        throw runtime_error("Archivo binario truncado: " + nombreArchivo);
+    }
+    CabeceraBinaria cabecera;
+    memcpy(&cabecera, datos, sizeof(cabecera));
+    if (cabecera.version != VERSION_BINARIA) {
+        throw runtime_error("Versión de formato binario no soportada: " + nombreArchivo);
     }
+    if (cabecera.numFuentesProd <= 0 || cabecera.numClientes <= 0 ||
+        cabecera.numFuentesProd > INT32_MAX || cabecera.numClientes > INT32_MAX) {
+        throw runtime_error("Dimensiones inválidas en el archivo binario: " + nombreArchivo);
+    }
+    numFuentesProd = cabecera.numFuentesProd;
+    numClientes = cabecera.numClientes;
 
-    // cout << "[Problema::Problema] Costos de activación: ";
-    // for (int j = 0; j < numFuentesProd; j++) {
-    //     cout << costosFuenteProd[j] << " ";
-    // }
-    // cout << "\n";
+    // Cada arreglo debe estar alineado a double y caber en el archivo
+    auto verificar = [&](uint64_t inicio, size_t cantidad) {
+        if (inicio % alignof(double) != 0 || inicio > tamano || cantidad > (tamano - inicio) / sizeof(double)) {
+            throw runtime_error("Archivo binario truncado o corrupto: " + nombreArchivo);
+        }
+        return reinterpret_cast<const double*>(datos + inicio);
+    };
+    const double* capacidades = verificar(cabecera.inicioCapacidades, numFuentesProd);
+    const double* activacion = verificar(cabecera.inicioCostosActivacion, numFuentesProd);
+    const double* demandas = verificar(cabecera.inicioDemandas, numClientes);
+    const double* costos = verificar(cabecera.inicioCostos, size_t(numClientes) * numFuentesProd);
 
-    // Leer demandas
-    for (int i = 0; i < numClientes; i++) {
-        archivo >> demandasClientes[i];
-    }
+    capacidadesFuenteProd.assign(capacidades, capacidades + numFuentesProd);
+    costosFuenteProd.assign(activacion, activacion + numFuentesProd);
+    demandasClientes.assign(demandas, demandas + numClientes);
+    matrizCostos = shared_ptr<const double>(archivo, costos);
+}
 
-    // cout << "[Problema::Problema] Demandas: ";
-    // for (int i = 0; i < numClientes; i++) {
-    //     cout << demandasClientes[i] << " ";
-    // }
-    // cout << "\n";
+/**
+ * Desc: Reserva un arreglo de double alineado a una línea de caché, para que los
+ *       recorridos sobre la matriz de costos empiecen en el borde de una línea.
+ * Params:
+ *   - cantidad: Número de double a reservar.
+ * Returns:
+ *   - shared_ptr<double>: Arreglo reservado (sin inicializar).
+ */
+shared_ptr<double> Problema::reservarAlineado(size_t cantidad) {
+    double* datos = new (align_val_t(ALINEACION_COSTOS)) double[cantidad];
+    return shared_ptr<double>(datos, [](double* p) { operator delete[](p, align_val_t(ALINEACION_COSTOS)); });
+}
 
-    // Leer matriz de costos de envío
-    for (int i = 0; i < numClientes; i++) {
-        for (int j = 0; j < numFuentesProd; j++) {
-            archivo >> matrizCostos[i][j];
+/**
+ * Desc: Guarda el problema en el formato binario, para cargarlo luego sin parsear.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo a crear.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si el archivo no se puede escribir.
+ */
+void Problema::guardarBinario(const string& nombreArchivo) const {
+    auto alinear = [](uint64_t bytes) { return (bytes + 63) & ~uint64_t(63); };
+    CabeceraBinaria cabecera;
+    memcpy(cabecera.magia, MAGIA_BINARIA, sizeof(cabecera.magia));
+    cabecera.version = VERSION_BINARIA;
+    cabecera.numFuentesProd = numFuentesProd;
+    cabecera.numClientes = numClientes;
+    cabecera.inicioCapacidades = alinear(sizeof(CabeceraBinaria));
+    cabecera.inicioCostosActivacion = alinear(cabecera.inicioCapacidades + numFuentesProd * sizeof(double));
+    cabecera.inicioDemandas = alinear(cabecera.inicioCostosActivacion + numFuentesProd * sizeof(double));
+    cabecera.inicioCostos = alinear(cabecera.inicioDemandas + numClientes * sizeof(double));
+
+    ofstream archivo(nombreArchivo, ios::binary);
+    if (!archivo.is_open()) {
+        throw runtime_error("No se pudo crear el archivo: " + nombreArchivo);
+    }
+    auto escribir = [&](uint64_t inicio, const double* valores, size_t cantidad) {
+        static const char ceros[64] = {};
+        archivo.write(ceros, inicio - archivo.tellp());
+        archivo.write(reinterpret_cast<const char*>(valores), cantidad * sizeof(double));
+    };
+    archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+    escribir(cabecera.inicioCapacidades, capacidadesFuenteProd.data(), numFuentesProd);
+    escribir(cabecera.inicioCostosActivacion, costosFuenteProd.data(), numFuentesProd);
+    escribir(cabecera.inicioDemandas, demandasClientes.data(), numClientes);
+    escribir(cabecera.inicioCostos, matrizCostos.get(), size_t(numClientes) * numFuentesProd);
+    if (!archivo) {
+        throw runtime_error("Error al escribir el archivo: " + nombreArchivo);
+    }
+}
+
+/**
+ * Desc: Guarda el problema en el formato de texto. Los números se escriben con
+ *       to_chars en su representación más corta que se relee exacta, en bloques,
+ *       para que instancias grandes no pasen por el flujo con locale de ofstream.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo a crear.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si el archivo no se puede escribir.
+ */
+void Problema::guardarTexto(const string& nombreArchivo) const {
+    ofstream archivo(nombreArchivo, ios::binary);
+    if (!archivo.is_open()) {
+        throw runtime_error("No se pudo crear el archivo: " + nombreArchivo);
+    }
+    string bloque;
+    auto escribirFila = [&](const double* valores, size_t cantidad) {
+        char numero[32];
+        for (size_t k = 0; k < cantidad; k++) {
+            char* fin = to_chars(numero, numero + sizeof(numero), valores[k]).ptr;
+            bloque.append(numero, fin);
+            bloque += k + 1 < cantidad ? ' ' : '\n';
         }
+        if (bloque.size() > (1 << 20)) {
+            archivo.write(bloque.data(), bloque.size());
+            bloque.clear();
+        }
+    };
+    bloque = to_string(numFuentesProd) + " " + to_string(numClientes) + "\n";
+    escribirFila(capacidadesFuenteProd.data(), numFuentesProd);
+    escribirFila(costosFuenteProd.data(), numFuentesProd);
+    escribirFila(demandasClientes.data(), numClientes);
+    for (int i = 0; i < numClientes; i++) {
+        escribirFila(matrizCostos.get() + size_t(i) * numFuentesProd, numFuentesProd);
+    }
+    archivo.write(bloque.data(), bloque.size());
+    if (!archivo) {
+        throw runtime_error("Error al escribir el archivo: " + nombreArchivo);
     }
-    // cout << "[Problema::Problema] Matriz de costos cargada\n";
-    archivo.close();
 }
 
 /**
@@ -95,7 +274,7 @@ void Problema::imprimir() const {
     cout << "Matriz de costos de envío:\n";
     for (int i = 0; i < numClientes; i++) {
         for (int j = 0; j < numFuentesProd; j++) {
-            cout << matrizCostos[i][j] << " ";
+            cout << getCostoEnvio(i, j) << " ";
         }
         cout << "\n";
     }
@@ -110,7 +289,7 @@ void Problema::imprimir() const {
  */
 bool Problema::esValido() const {
     return numClientes > 0 && numFuentesProd > 0 && 
-            matrizCostos.size() == numClientes && 
+            matrizCostos != nullptr && 
             costosFuenteProd.size() == numFuentesProd && 
             demandasClientes.size() == numClientes && 
             capacidadesFuenteProd.size() == numFuentesProd;
@@ -140,7 +319,169 @@ int Problema::getNumFuentesProd() const { return numFuentesProd; }
  * Returns:
  *   - double: Costo de envío desde la fuente al cliente.
  */
-double Problema::getCostoEnvio(int cliente, int fuenteProd) const { return matrizCostos[cliente][fuenteProd]; }
+double Problema::getCostoEnvio(int cliente, int fuenteProd) const {
+    return matrizCostos.get()[size_t(cliente) * numFuentesProd + fuenteProd];
+}
+
+/**
+ * Desc: Devuelve la matriz de costos completa, contigua y en orden fila por cliente.
+ * Params: void
+ * Returns:
+ *   - VistaCostos: numClientes*numFuentesProd costos, c[i][j] en i*numFuentesProd + j.
+ */
+VistaCostos Problema::getMatrizCostos() const {
+    return {matrizCostos.get(), size_t(numClientes) * numFuentesProd};
+}
+
+/**
+ * Desc: Devuelve los costos de envío de un cliente a todas las fuentes, contiguos.
+ * Params:
+ *   - cliente: Índice del cliente.
+ * Returns:
+ *   - VistaCostos: numFuentesProd costos c[cliente][j].
+ */
+VistaCostos Problema::getCostosCliente(int cliente) const {
+    return {matrizCostos.get() + size_t(cliente) * numFuentesProd, size_t(numFuentesProd)};
+}
+
+/**
+ * Desc: Devuelve los costos de envío de todos los clientes a una fuente, contiguos.
+ *       Usa la copia transpuesta de la matriz, que se arma (una sola vez, aunque
+ *       la pidan varios hilos a la vez) la primera vez que se necesita.
+ * Params:
+ *   - fuenteProd: Índice de la fuente de producción.
+ * Returns:
+ *   - VistaCostos: numClientes costos c[i][fuenteProd].
+ */
+VistaCostos Problema::getCostosFuente(int fuenteProd) const {
+    call_once(transpuesta->armada, [this] {
+        shared_ptr<double> datos = reservarAlineado(size_t(numClientes) * numFuentesProd);
+        const double* costos = matrizCostos.get();
+        // Por bloques, para que origen y destino se lean y escriban por líneas completas
+        const int BLOQUE = 64;
+        for (int i0 = 0; i0 < numClientes; i0 += BLOQUE) {
+            for (int j0 = 0; j0 < numFuentesProd; j0 += BLOQUE) {
+                int iFin = min(i0 + BLOQUE, numClientes);
+                int jFin = min(j0 + BLOQUE, numFuentesProd);
+                for (int i = i0; i < iFin; i++) {
+                    for (int j = j0; j < jFin; j++) {
+                        datos.get()[size_t(j) * numClientes + i] = costos[size_t(i) * numFuentesProd + j];
+                    }
+                }
+            }
+        }
+        transpuesta->datos = datos;
+    });
+    return {transpuesta->datos.get() + size_t(fuenteProd) * numClientes, size_t(numClientes)};
+}
+
+/**
+ * Desc: Indica si el arco de un cliente a una fuente puede llevar flujo.
+ * Params:
+ *   - cliente: Índice del cliente.
+ *   - fuenteProd: Índice de la fuente de producción.
+ * Returns:
+ *   - bool: False si el arco fue prohibido (por ejemplo, por la reducción).
+ */
+bool Problema::esArcoPermitido(int cliente, int fuenteProd) const {
+    return arcosProhibidos.empty() || !arcosProhibidos[size_t(cliente) * numFuentesProd + fuenteProd];
+}
+
+/**
+ * Desc: Prohíbe el envío de un cliente a una fuente (x_ij = 0). Los modelos y el
+ *       evaluador de transporte no usan los arcos prohibidos. La marca no se guarda
+ *       en el formato binario.
+ * Params:
+ *   - cliente: Índice del cliente.
+ *   - fuenteProd: Índice de la fuente de producción.
+ * Returns: void
+ */
+void Problema::prohibirArco(int cliente, int fuenteProd) {
+    if (arcosProhibidos.empty()) {
+        arcosProhibidos.assign(size_t(numClientes) * numFuentesProd, 0);
+    }
+    arcosProhibidos[size_t(cliente) * numFuentesProd + fuenteProd] = 1;
+}
+
+/**
+ * Desc: Calcula una huella de 64 bits del contenido del problema (dimensiones,
+ *       capacidades, costos de activación, demandas, costos de envío y arcos
+ *       prohibidos), para reconocer la misma instancia aunque se cargue de otro
+ *       archivo o formato. Los costos se recorren en cuatro acumuladores
+ *       independientes para que la mezcla no quede limitada por su latencia.
+ * Params: void
+ * Returns:
+ *   - uint64_t: Huella del problema; es la misma para datos idénticos bit a bit.
+ */
+uint64_t Problema::calcularHuella() const {
+    const uint64_t MULTIPLICADOR = 0x9E3779B97F4A7C15ull;
+    auto mezclar = [&](uint64_t h, uint64_t palabra) {
+        h = (h ^ palabra) * MULTIPLICADOR;
+        return h ^ (h >> 29);
+    };
+    auto palabra = [](double valor) {
+        uint64_t bits;
+        memcpy(&bits, &valor, sizeof(bits));
+        return valor == 0.0 ? uint64_t(0) : bits;  // -0.0 y 0.0 son el mismo dato
+    };
+    auto mezclarArreglo = [&](uint64_t h, const double* valores, size_t cantidad) {
+        uint64_t acumuladores[4] = {h, h + 1, h + 2, h + 3};
+        size_t k = 0;
+        for (; k + 4 <= cantidad; k += 4) {
+            for (int a = 0; a < 4; a++) {
+                acumuladores[a] = mezclar(acumuladores[a], palabra(valores[k + a]));
+            }
+        }
+        for (; k < cantidad; k++) {
+            acumuladores[0] = mezclar(acumuladores[0], palabra(valores[k]));
+        }
+        for (uint64_t acumulador : acumuladores) {
+            h = mezclar(h, acumulador);
+        }
+        return mezclar(h, cantidad);
+    };
+
+    uint64_t h = mezclar(mezclar(0xCF1B0000ull, uint64_t(numFuentesProd)), uint64_t(numClientes));
+    h = mezclarArreglo(h, capacidadesFuenteProd.data(), capacidadesFuenteProd.size());
+    h = mezclarArreglo(h, costosFuenteProd.data(), costosFuenteProd.size());
+    h = mezclarArreglo(h, demandasClientes.data(), demandasClientes.size());
+    h = mezclarArreglo(h, matrizCostos.get(), size_t(numClientes) * numFuentesProd);
+    for (size_t k = 0; k < arcosProhibidos.size(); k++) {
+        if (arcosProhibidos[k]) {
+            h = mezclar(h, k + 1);
+        }
+    }
+    return h;
+}
+
+/**
+ * Desc: Cambia demandas y costos de activación. Las copias del problema comparten
+ *       la matriz de costos (y su transpuesta), que no se toca, así que copiar un
+ *       problema y aplicarle un cambio solo copia los vectores de largo n y m.
+ * Params:
+ *   - cambio: Nuevos valores por índice.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si un índice está fuera de rango o un valor es negativo.
+ */
+void Problema::aplicarCambio(const CambioProblema& cambio) {
+    for (const auto& [cliente, demanda] : cambio.demandas) {
+        if (cliente < 0 || cliente >= numClientes || demanda < 0) {
+            throw runtime_error("Cambio de demanda inválido para el cliente " + to_string(cliente));
+        }
+    }
+    for (const auto& [fuenteProd, costo] : cambio.costosActivacion) {
+        if (fuenteProd < 0 || fuenteProd >= numFuentesProd || costo < 0) {
+            throw runtime_error("Cambio de costo de activación inválido para la fuente " + to_string(fuenteProd));
+        }
+    }
+    for (const auto& [cliente, demanda] : cambio.demandas) {
+        demandasClientes[cliente] = demanda;
+    }
+    for (const auto& [fuenteProd, costo] : cambio.costosActivacion) {
+        costosFuenteProd[fuenteProd] = costo;
+    }
+}
 
 /**
  * Desc: Devuelve el costo de activar una fuente de producción específica.
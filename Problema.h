@@ -7,20 +7,76 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <memory>
+#include <cstdint>
+#include <mutex>
 
 using namespace std;
 
+// Vista de solo lectura sobre costos contiguos (al estilo de span), para recorrer
+// una fila o una columna de la matriz de costos sin copiarla.
+struct VistaCostos {
+    const double* datos;
+    size_t tamano;
+
+    const double* begin() const { return datos; }
+    const double* end() const { return datos + tamano; }
+    double operator[](size_t k) const { return datos[k]; }
+    size_t size() const { return tamano; }
+};
+
+// Cabecera del formato binario de instancias. Los arreglos de double van a
+// continuación, cada uno alineado a 64 bytes; los costos c[i][j] en orden fila
+// por cliente. Se lee con mmap y los costos se usan en su lugar, sin copiarlos.
+struct CabeceraBinaria {
+    char magia[4];                    // "CFLB"
+    uint32_t version;
+    int64_t numFuentesProd;
+    int64_t numClientes;
+    uint64_t inicioCapacidades;       // desplazamientos en bytes desde el inicio del archivo
+    uint64_t inicioCostosActivacion;
+    uint64_t inicioDemandas;
+    uint64_t inicioCostos;
+};
+
+// Cambio a aplicar sobre un problema ya resuelto: nuevas demandas y costos de
+// activación como pares (índice, valor). La matriz de costos no cambia.
+struct CambioProblema {
+    vector<pair<int, double>> demandas;
+    vector<pair<int, double>> costosActivacion;
+
+    bool cambiaDemandas() const { return !demandas.empty(); }
+};
+
 class Problema {
 private:
     int numClientes;
     int numFuentesProd;
-    vector<vector<double>> matrizCostos; // c[i][j]
+    shared_ptr<const double> matrizCostos; // c[i][j] en la posición i*numFuentesProd + j
+
+    // Copia transpuesta (c[i][j] en la posición j*numClientes + i), armada la primera
+    // vez que se pide y compartida entre las copias del problema
+    struct MatrizTranspuesta {
+        once_flag armada;
+        shared_ptr<const double> datos;
+    };
+    shared_ptr<MatrizTranspuesta> transpuesta;
     vector<double> costosFuenteProd; // f[j]
     vector<double> demandasClientes; // d[i]
     vector<double> capacidadesFuenteProd; // M[j]
+    vector<unsigned char> arcosProhibidos; // 1 en i*numFuentesProd + j si x_ij debe ser 0; vacío si no hay
+
+    void cargarTexto(const string& nombreArchivo);
+    void cargarBinario(const string& nombreArchivo);
+    static shared_ptr<double> reservarAlineado(size_t cantidad);
 
 public:
     Problema(const string& nombreArchivo);
+    Problema(const vector<double>& capacidades, const vector<double>& costosActivacion, const vector<double>& demandas,
+             const vector<double>& costos);
+    static bool esArchivoBinario(const string& nombreArchivo);
+    void guardarBinario(const string& nombreArchivo) const;
+    void guardarTexto(const string& nombreArchivo) const;
     
     // Getters
     int getNumClientes() const;
@@ -31,6 +87,15 @@ public:
     double getCapacidad(int fuenteProd) const;
     const vector<double>& getCapacidades() const;
     const vector<double>& getDemandas() const;
+    VistaCostos getMatrizCostos() const;
+    VistaCostos getCostosCliente(int cliente) const;
+    VistaCostos getCostosFuente(int fuenteProd) const;
+    bool esArcoPermitido(int cliente, int fuenteProd) const;
+    uint64_t calcularHuella() const;
+    
+    // Modificadores
+    void prohibirArco(int cliente, int fuenteProd);
+    void aplicarCambio(const CambioProblema& cambio);
     
     // Utilidades
     void imprimir() const;
@@ -0,0 +1,76 @@
+#include "RamificacionConfiabilidad.h"
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+/**
+ * Desc: Constructor de la ramificación por confiabilidad.
+ * Params:
+ *   - umbral: Observaciones por rama a partir de las cuales se confía en el pseudo-costo.
+ *   - maxIterSimplex: Iteraciones del simplex dual por rama al probar una candidata.
+ *   - maxSinMejora: Candidatas probadas seguidas sin mejorar antes de detenerse.
+ * Returns: void
+ */
+RamificacionConfiabilidad::RamificacionConfiabilidad(int umbral, int maxIterSimplex, int maxSinMejora)
+    : umbralConfiabilidad(umbral), maxIterSimplex(maxIterSimplex), maxSinMejora(maxSinMejora) {}
+
+/**
+ * Desc: Recorre las candidatas en orden de puntaje por pseudo-costos. Las que aún
+ *       no tienen suficientes observaciones se prueban con ramificación fuerte, cuyo
+ *       resultado también alimenta los pseudo-costos. Se detiene tras maxSinMejora
+ *       pruebas seguidas que no mejoran a la mejor candidata.
+ * Params:
+ *   - modelo: Modelo LP del hilo, con el nodo recién resuelto.
+ *   - valoresY: Valores y_j de la relajación del nodo.
+ *   - base: Base óptima del nodo.
+ *   - cotaNodo: Cota inferior del nodo.
+ * Returns:
+ *   - int: Índice de la variable, o -1 si la solución es entera.
+ */
+int RamificacionConfiabilidad::elegirVariable(ModeloRelajacionLP& modelo, const vector<double>& valoresY,
+                                              const unsigned char* base, double cotaNodo) {
+    vector<int> candidatos = obtenerCandidatos(valoresY);
+    if (candidatos.empty()) {
+        return -1;
+    }
+
+    // Puntajes estimados y confiabilidad, leídos de una vez bajo el mutex
+    vector<tuple<double, int, bool>> estimados;
+    {
+        lock_guard<mutex> lock(mtx);
+        asegurarTamano(valoresY.size());
+        for (int j : candidatos) {
+            double f = valoresY[j] - floor(valoresY[j]);
+            double p = puntaje(promedio(sumaAbajo, cuentaAbajo, j) * f, promedio(sumaArriba, cuentaArriba, j) * (1.0 - f));
+            bool confiable = min(cuentaAbajo[j], cuentaArriba[j]) >= umbralConfiabilidad;
+            estimados.emplace_back(-p, j, confiable);
+        }
+    }
+    sort(estimados.begin(), estimados.end());
+
+    int mejorVar = get<1>(estimados.front());
+    double mejorPuntaje = -1.0;
+    int sinMejora = 0;
+    for (const auto& [menosPuntaje, j, confiable] : estimados) {
+        double p = -menosPuntaje;
+        if (!confiable) {
+            double cotaAbajo = modelo.resolverTentativo(j, 0, base, maxIterSimplex);
+            double cotaArriba = modelo.resolverTentativo(j, 1, base, maxIterSimplex);
+            if (cotaAbajo < COIN_DBL_MAX) {
+                registrarRama(j, 0, valoresY[j], cotaNodo, cotaAbajo);
+            }
+            if (cotaArriba < COIN_DBL_MAX) {
+                registrarRama(j, 1, valoresY[j], cotaNodo, cotaArriba);
+            }
+            p = puntaje(cotaAbajo - cotaNodo, cotaArriba - cotaNodo);
+        }
+        if (p > mejorPuntaje) {
+            mejorPuntaje = p;
+            mejorVar = j;
+            sinMejora = 0;
+        } else if (!confiable && ++sinMejora >= maxSinMejora) {
+            break;
+        }
+    }
+    return mejorVar;
+}
@@ -0,0 +1,22 @@
+#ifndef RAMIFICACION_CONFIABILIDAD_H
+#define RAMIFICACION_CONFIABILIDAD_H
+
+#include "RamificacionPseudoCosto.h"
+
+using namespace std;
+
+class RamificacionConfiabilidad : public RamificacionPseudoCosto {
+private:
+    int umbralConfiabilidad;
+    int maxIterSimplex;
+    int maxSinMejora;
+
+public:
+    RamificacionConfiabilidad(int umbral = 4, int maxIterSimplex = 30, int maxSinMejora = 4);
+
+    int elegirVariable(ModeloRelajacionLP& modelo, const vector<double>& valoresY,
+                       const unsigned char* base, double cotaNodo) override;
+    string getNombre() const override { return "Confiabilidad"; }
+};
+
+#endif // RAMIFICACION_CONFIABILIDAD_H
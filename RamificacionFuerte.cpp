@@ -0,0 +1,40 @@
+#include "RamificacionFuerte.h"
+
+/**
+ * Desc: Constructor de la ramificación fuerte.
+ * Params:
+ *   - maxCandidatos: Cuántas de las variables más fraccionarias se prueban.
+ *   - maxIterSimplex: Iteraciones del simplex dual permitidas por rama.
+ * Returns: void
+ */
+RamificacionFuerte::RamificacionFuerte(int maxCandidatos, int maxIterSimplex)
+    : maxCandidatos(maxCandidatos), maxIterSimplex(maxIterSimplex) {}
+
+/**
+ * Desc: Resuelve de forma tentativa ambas ramas de cada candidata, partiendo de la
+ *       base del nodo y con pocas iteraciones, y elige la de mejor puntaje.
+ * Params:
+ *   - modelo: Modelo LP del hilo, con el nodo recién resuelto.
+ *   - valoresY: Valores y_j de la relajación del nodo.
+ *   - base: Base óptima del nodo.
+ *   - cotaNodo: Cota inferior del nodo.
+ * Returns:
+ *   - int: Índice de la variable, o -1 si la solución es entera.
+ */
+int RamificacionFuerte::elegirVariable(ModeloRelajacionLP& modelo, const vector<double>& valoresY,
+                                       const unsigned char* base, double cotaNodo) {
+    vector<int> candidatos = obtenerCandidatos(valoresY);
+    int mejorVar = candidatos.empty() ? -1 : candidatos.front();
+    double mejorPuntaje = -1.0;
+    for (int k = 0; k < (int)candidatos.size() && k < maxCandidatos; k++) {
+        int j = candidatos[k];
+        double abajo = modelo.resolverTentativo(j, 0, base, maxIterSimplex) - cotaNodo;
+        double arriba = modelo.resolverTentativo(j, 1, base, maxIterSimplex) - cotaNodo;
+        double p = puntaje(abajo, arriba);
+        if (p > mejorPuntaje) {
+            mejorPuntaje = p;
+            mejorVar = j;
+        }
+    }
+    return mejorVar;
+}
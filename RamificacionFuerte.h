@@ -0,0 +1,21 @@
+#ifndef RAMIFICACION_FUERTE_H
+#define RAMIFICACION_FUERTE_H
+
+#include "ReglaRamificacion.h"
+
+using namespace std;
+
+class RamificacionFuerte : public ReglaRamificacion {
+private:
+    int maxCandidatos;
+    int maxIterSimplex;
+
+public:
+    RamificacionFuerte(int maxCandidatos = 8, int maxIterSimplex = 30);
+
+    int elegirVariable(ModeloRelajacionLP& modelo, const vector<double>& valoresY,
+                       const unsigned char* base, double cotaNodo) override;
+    string getNombre() const override { return "Fuerte"; }
+};
+
+#endif // RAMIFICACION_FUERTE_H
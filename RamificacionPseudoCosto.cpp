@@ -0,0 +1,128 @@
+#include "RamificacionPseudoCosto.h"
+#include <cmath>
+
+/**
+ * Desc: Agranda las tablas si aparece una variable que aún no tienen.
+ *       Debe llamarse con el mutex tomado.
+ * Params:
+ *   - numVars: Número de variables y_j.
+ * Returns: void
+ */
+void RamificacionPseudoCosto::asegurarTamano(int numVars) {
+    if ((int)sumaAbajo.size() < numVars) {
+        sumaAbajo.resize(numVars, 0.0);
+        sumaArriba.resize(numVars, 0.0);
+        cuentaAbajo.resize(numVars, 0);
+        cuentaArriba.resize(numVars, 0);
+    }
+}
+
+/**
+ * Desc: Pseudo-costo de una rama: el promedio observado de la variable o, si nunca
+ *       se ha ramificado en ella, el promedio de las variables ya observadas.
+ *       Debe llamarse con el mutex tomado.
+ * Params:
+ *   - suma: Tabla de sumas de la rama.
+ *   - cuenta: Tabla de observaciones de la rama.
+ *   - var: Índice de la variable.
+ * Returns:
+ *   - double: Aumento de cota estimado por unidad de fracción.
+ */
+double RamificacionPseudoCosto::promedio(const vector<double>& suma, const vector<int>& cuenta, int var) const {
+    if (var < (int)cuenta.size() && cuenta[var] > 0) {
+        return suma[var] / cuenta[var];
+    }
+    double total = 0.0;
+    int observadas = 0;
+    for (int j = 0; j < (int)cuenta.size(); j++) {
+        if (cuenta[j] > 0) {
+            total += suma[j] / cuenta[j];
+            observadas++;
+        }
+    }
+    return observadas > 0 ? total / observadas : 1.0;
+}
+
+/**
+ * Desc: Elige la candidata con mejor puntaje estimado: pseudo-costo de cada rama
+ *       por la distancia que esa rama mueve a la variable.
+ * Params:
+ *   - modelo: Modelo LP del hilo (no se usa en esta regla).
+ *   - valoresY: Valores y_j de la relajación del nodo.
+ *   - base: Base óptima del nodo (no se usa en esta regla).
+ *   - cotaNodo: Cota inferior del nodo (no se usa en esta regla).
+ * Returns:
+ *   - int: Índice de la variable, o -1 si la solución es entera.
+ */
+int RamificacionPseudoCosto::elegirVariable(ModeloRelajacionLP& /*modelo*/, const vector<double>& valoresY,
+                                            const unsigned char* /*base*/, double /*cotaNodo*/) {
+    vector<int> candidatos = obtenerCandidatos(valoresY);
+    int mejorVar = candidatos.empty() ? -1 : candidatos.front();
+    double mejorPuntaje = -1.0;
+    lock_guard<mutex> lock(mtx);
+    for (int j : candidatos) {
+        double f = valoresY[j] - floor(valoresY[j]);
+        double p = puntaje(promedio(sumaAbajo, cuentaAbajo, j) * f, promedio(sumaArriba, cuentaArriba, j) * (1.0 - f));
+        if (p > mejorPuntaje) {
+            mejorPuntaje = p;
+            mejorVar = j;
+        }
+    }
+    return mejorVar;
+}
+
+/**
+ * Desc: Aprende de un hijo recién resuelto: el aumento de cota dividido por lo que
+ *       la rama movió a la variable (f hacia 0, o 1 - f hacia 1).
+ * Params:
+ *   - var: Variable por la que se ramificó.
+ *   - valor: Rama del hijo (0 o 1).
+ *   - valorPadre: Valor LP de la variable en el padre.
+ *   - cotaPadre: Cota inferior del padre.
+ *   - cotaHijo: Cota inferior del hijo.
+ * Returns: void
+ */
+void RamificacionPseudoCosto::registrarRama(int var, int valor, double valorPadre, double cotaPadre, double cotaHijo) {
+    double f = valorPadre - floor(valorPadre);
+    double distancia = valor == 0 ? f : 1.0 - f;
+    if (distancia < 1e-6 || var < 0) {
+        return;
+    }
+    double unitario = max(cotaHijo - cotaPadre, 0.0) / distancia;
+    lock_guard<mutex> lock(mtx);
+    asegurarTamano(var + 1);
+    if (valor == 0) {
+        sumaAbajo[var] += unitario;
+        cuentaAbajo[var]++;
+    } else {
+        sumaArriba[var] += unitario;
+        cuentaArriba[var]++;
+    }
+}
+
+/**
+ * Desc: Devuelve el pseudo-costo actual de una rama.
+ * Params:
+ *   - var: Índice de la variable.
+ *   - valor: Rama (0 o 1).
+ * Returns:
+ *   - double: Aumento de cota estimado por unidad de fracción.
+ */
+double RamificacionPseudoCosto::obtenerPseudoCosto(int var, int valor) const {
+    lock_guard<mutex> lock(mtx);
+    return valor == 0 ? promedio(sumaAbajo, cuentaAbajo, var) : promedio(sumaArriba, cuentaArriba, var);
+}
+
+/**
+ * Desc: Devuelve cuántas veces se ha observado una rama de la variable.
+ * Params:
+ *   - var: Índice de la variable.
+ *   - valor: Rama (0 o 1).
+ * Returns:
+ *   - int: Número de observaciones.
+ */
+int RamificacionPseudoCosto::obtenerObservaciones(int var, int valor) const {
+    lock_guard<mutex> lock(mtx);
+    const vector<int>& cuenta = valor == 0 ? cuentaAbajo : cuentaArriba;
+    return var < (int)cuenta.size() ? cuenta[var] : 0;
+}
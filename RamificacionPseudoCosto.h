@@ -0,0 +1,30 @@
+#ifndef RAMIFICACION_PSEUDO_COSTO_H
+#define RAMIFICACION_PSEUDO_COSTO_H
+
+#include "ReglaRamificacion.h"
+#include <mutex>
+
+using namespace std;
+
+class RamificacionPseudoCosto : public ReglaRamificacion {
+protected:
+    // Suma y cantidad de aumentos de cota por unidad de fracción, por variable y rama
+    vector<double> sumaAbajo;
+    vector<double> sumaArriba;
+    vector<int> cuentaAbajo;
+    vector<int> cuentaArriba;
+    mutable mutex mtx;
+
+    void asegurarTamano(int numVars);
+    double promedio(const vector<double>& suma, const vector<int>& cuenta, int var) const;
+
+public:
+    int elegirVariable(ModeloRelajacionLP& modelo, const vector<double>& valoresY,
+                       const unsigned char* base, double cotaNodo) override;
+    void registrarRama(int var, int valor, double valorPadre, double cotaPadre, double cotaHijo) override;
+    double obtenerPseudoCosto(int var, int valor) const;
+    int obtenerObservaciones(int var, int valor) const;
+    string getNombre() const override { return "Pseudo-costos"; }
+};
+
+#endif // RAMIFICACION_PSEUDO_COSTO_H
@@ -0,0 +1,256 @@
+#include "ReduccionProblema.h"
+#include <numeric>
+
+static const double EPS = 1e-9;
+
+/**
+ * Desc: Constructor por defecto. La reducción se arma en reducir().
+ * Params: void
+ * Returns: void
+ */
+ReduccionProblema::ReduccionProblema()
+    : numFuentesOriginal(0), costoFijo(0.0), numFijadasAbiertas(0), numDominadas(0), numArcosProhibidos(0),
+      numClientesEliminados(0), numCapacidadesAjustadas(0) {}
+
+/**
+ * Desc: Arma el problema reducido. Si la capacidad total no cubre la demanda, el
+ *       problema es infactible y se devuelve una copia sin reducir (la estrategia
+ *       lo detecta igual).
+ *       Una fuente k es dominada por j si f_j <= f_k, c_ij <= c_ik para todo i y
+ *       M_j >= D: cualquier solución con k abierta mejora o empata cerrando k y
+ *       abriendo j, que puede absorber su flujo. (Con M_j < D no vale, porque la
+ *       solución puede necesitar a las dos abiertas.)
+ *       Una fuente j debe abrirse si las demás fuentes que quedan no suman D.
+ *       Si una fuente obligada k tiene M_k >= D, enviar por el arco (i, j) con
+ *       c_ij > c_ik nunca conviene: ese flujo cabe en k y cuesta menos.
+ * Params:
+ *   - original: Problema a reducir.
+ * Returns:
+ *   - Problema: Problema reducido, con las fuentes en el orden de fuenteOriginal.
+ */
+Problema ReduccionProblema::reducir(const Problema& original) {
+    int n = original.getNumClientes();
+    int m = original.getNumFuentesProd();
+    numFuentesOriginal = m;
+    costoFijo = 0.0;
+    numFijadasAbiertas = numDominadas = numArcosProhibidos = numClientesEliminados = numCapacidadesAjustadas = 0;
+    fuenteOriginal.resize(m);
+    iota(fuenteOriginal.begin(), fuenteOriginal.end(), 0);
+
+    double demandaTotal = 0.0;
+    for (double d : original.getDemandas()) {
+        demandaTotal += d;
+    }
+    vector<double> capacidades = original.getCapacidades();
+    double capacidadTotal = accumulate(capacidades.begin(), capacidades.end(), 0.0);
+    if (capacidadTotal < demandaTotal - EPS) {
+        return original;
+    }
+
+    // 1. Ajustar capacidades a la demanda total
+    for (double& M : capacidades) {
+        if (M > demandaTotal) {
+            M = demandaTotal;
+            numCapacidadesAjustadas++;
+        }
+    }
+
+    // 2. Fuentes dominadas (los empates se rompen por índice)
+    vector<char> eliminada(m, 0);
+    for (int j = 0; j < m; j++) {
+        // Si j ya fue eliminada, quien la domina también domina a lo que j domine
+        if (eliminada[j] || capacidades[j] < demandaTotal - EPS) {
+            continue;
+        }
+        VistaCostos costosJ = original.getCostosFuente(j);
+        for (int k = 0; k < m; k++) {
+            if (k == j || eliminada[k] || original.getCostoActivacion(j) > original.getCostoActivacion(k)) {
+                continue;
+            }
+            VistaCostos costosK = original.getCostosFuente(k);
+            bool domina = true;
+            bool igual = original.getCostoActivacion(j) == original.getCostoActivacion(k) && capacidades[k] >= demandaTotal - EPS;
+            for (int i = 0; i < n && domina; i++) {
+                domina = costosJ[i] <= costosK[i];
+                igual = igual && costosJ[i] == costosK[i];
+            }
+            if (domina && !(igual && k < j)) {
+                eliminada[k] = 1;
+                numDominadas++;
+            }
+        }
+    }
+    fuenteOriginal.clear();
+    double capacidadRestante = 0.0;
+    for (int j = 0; j < m; j++) {
+        if (!eliminada[j]) {
+            fuenteOriginal.push_back(j);
+            capacidadRestante += capacidades[j];
+        }
+    }
+    int mReducido = fuenteOriginal.size();
+
+    // 3. Fuentes obligadas: quedan con activación 0 y su costo pasa a costoFijo
+    vector<double> capacidadesReducidas(mReducido);
+    vector<double> activacionReducida(mReducido);
+    int obligadaQueCubre = -1;
+    for (int r = 0; r < mReducido; r++) {
+        int j = fuenteOriginal[r];
+        capacidadesReducidas[r] = capacidades[j];
+        activacionReducida[r] = original.getCostoActivacion(j);
+        if (capacidadRestante - capacidades[j] < demandaTotal - EPS) {
+            costoFijo += activacionReducida[r];
+            activacionReducida[r] = 0.0;
+            numFijadasAbiertas++;
+            if (capacidades[j] >= demandaTotal - EPS && obligadaQueCubre < 0) {
+                obligadaQueCubre = r;
+            }
+        }
+    }
+
+    // 4. Clientes con demanda (si ninguno la tiene se deja uno, para no dejar el problema vacío)
+    vector<int> clientes;
+    for (int i = 0; i < n; i++) {
+        if (original.getDemanda(i) > 0.0) {
+            clientes.push_back(i);
+        }
+    }
+    if (clientes.empty()) {
+        clientes.push_back(0);
+    }
+    numClientesEliminados = n - clientes.size();
+
+    vector<double> demandas(clientes.size());
+    vector<double> costos(clientes.size() * mReducido);
+    for (size_t c = 0; c < clientes.size(); c++) {
+        demandas[c] = original.getDemanda(clientes[c]);
+        VistaCostos costosCliente = original.getCostosCliente(clientes[c]);
+        for (int r = 0; r < mReducido; r++) {
+            costos[c * mReducido + r] = costosCliente[fuenteOriginal[r]];
+        }
+    }
+    Problema reducido(capacidadesReducidas, activacionReducida, demandas, costos);
+
+    // 5. Arcos que nunca convienen frente a una fuente obligada que cubre D
+    for (int c = 0; c < (int)clientes.size(); c++) {
+        for (int r = 0; r < mReducido; r++) {
+            bool prohibido = !original.esArcoPermitido(clientes[c], fuenteOriginal[r]);
+            if (!prohibido && obligadaQueCubre >= 0 && r != obligadaQueCubre) {
+                prohibido = costos[c * mReducido + r] > costos[c * mReducido + obligadaQueCubre];
+                numArcosProhibidos += prohibido;
+            }
+            if (prohibido) {
+                reducido.prohibirArco(c, r);
+            }
+        }
+    }
+    return reducido;
+}
+
+/**
+ * Desc: Lleva una solución del problema reducido al original (postsolve): las
+ *       fuentes eliminadas quedan cerradas.
+ * Params:
+ *   - solucionReducida: Activación de las fuentes del problema reducido.
+ * Returns:
+ *   - vector<double>: Activación de las fuentes del problema original.
+ */
+vector<double> ReduccionProblema::recuperarSolucion(const vector<double>& solucionReducida) const {
+    vector<double> solucion(numFuentesOriginal, 0.0);
+    for (size_t r = 0; r < solucionReducida.size() && r < fuenteOriginal.size(); r++) {
+        solucion[fuenteOriginal[r]] = solucionReducida[r];
+    }
+    return solucion;
+}
+
+/**
+ * Desc: Lleva un costo del problema reducido al original, sumando la activación
+ *       de las fuentes obligadas.
+ * Params:
+ *   - costoReducido: Costo en el problema reducido.
+ * Returns:
+ *   - double: Costo en el problema original.
+ */
+double ReduccionProblema::recuperarCosto(double costoReducido) const { return costoReducido + costoFijo; }
+
+/**
+ * Desc: Lleva el resultado de una estrategia sobre el problema reducido al original.
+ * Params:
+ *   - resultadoReducido: Resultado sobre el problema reducido.
+ * Returns:
+ *   - ResultadoSolucion: Mismo resultado, con la solución, el costo y las cotas del original.
+ */
+ResultadoSolucion ReduccionProblema::recuperar(const ResultadoSolucion& resultadoReducido) const {
+    ResultadoSolucion resultado = resultadoReducido;
+    if (resultado.esFactible) {
+        resultado.solucionFinal = recuperarSolucion(resultadoReducido.solucionFinal);
+        resultado.valorObjetivo = recuperarCosto(resultadoReducido.valorObjetivo);
+    }
+    if (resultado.cotaInferior < 1e20) {
+        resultado.cotaRaiz = recuperarCosto(resultadoReducido.cotaRaiz);
+        resultado.cotaInferior = recuperarCosto(resultadoReducido.cotaInferior);
+    }
+    resultado.actualizarBrecha();
+    return resultado;
+}
+
+/**
+ * Desc: Indica si la última reducción cambió algo del problema.
+ * Params: void
+ * Returns:
+ *   - bool: True si se fijó, eliminó, prohibió o ajustó algo.
+ */
+bool ReduccionProblema::reduceAlgo() const {
+    return numFijadasAbiertas + numDominadas + numArcosProhibidos + numClientesEliminados + numCapacidadesAjustadas > 0;
+}
+
+/**
+ * Desc: Imprime en consola lo que hizo la última reducción.
+ * Params: void
+ * Returns: void
+ */
+void ReduccionProblema::imprimirResumen() const {
+    cout << "Reducción: " << numFijadasAbiertas << " fuentes obligadas, " << numDominadas << " dominadas, "
+         << numArcosProhibidos << " arcos prohibidos, " << numClientesEliminados << " clientes sin demanda, "
+         << numCapacidadesAjustadas << " capacidades ajustadas\n";
+}
+
+/**
+ * Desc: Devuelve cuántas fuentes deben abrirse en toda solución factible.
+ * Params: void
+ * Returns:
+ *   - int: Fuentes obligadas.
+ */
+int ReduccionProblema::obtenerFijadasAbiertas() const { return numFijadasAbiertas; }
+
+/**
+ * Desc: Devuelve cuántas fuentes se eliminaron por dominancia.
+ * Params: void
+ * Returns:
+ *   - int: Fuentes dominadas.
+ */
+int ReduccionProblema::obtenerDominadas() const { return numDominadas; }
+
+/**
+ * Desc: Devuelve cuántos arcos cliente-fuente se prohibieron.
+ * Params: void
+ * Returns:
+ *   - int: Arcos prohibidos.
+ */
+int ReduccionProblema::obtenerArcosProhibidos() const { return numArcosProhibidos; }
+
+/**
+ * Desc: Devuelve cuántos clientes sin demanda se eliminaron.
+ * Params: void
+ * Returns:
+ *   - int: Clientes eliminados.
+ */
+int ReduccionProblema::obtenerClientesEliminados() const { return numClientesEliminados; }
+
+/**
+ * Desc: Devuelve cuántas capacidades se ajustaron a la demanda total.
+ * Params: void
+ * Returns:
+ *   - int: Capacidades ajustadas.
+ */
+int ReduccionProblema::obtenerCapacidadesAjustadas() const { return numCapacidadesAjustadas; }
@@ -0,0 +1,48 @@
+#ifndef REDUCCION_PROBLEMA_H
+#define REDUCCION_PROBLEMA_H
+
+#include "Problema.h"
+#include "StrategyResolucion.h"
+#include <vector>
+#include <memory>
+
+using namespace std;
+
+// Presolve: arma un problema reducido equivalente y guarda lo necesario para llevar
+// su solución de vuelta al problema original (postsolve).
+//  - M_j se ajusta a min(M_j, D).
+//  - Se eliminan las fuentes dominadas por otra que es más barata de abrir, más
+//    barata para cada cliente y capaz de atender sola toda la demanda.
+//  - Las fuentes que deben abrirse (sin ellas no se cubre la demanda) quedan con
+//    costo de activación 0; ese costo pasa a una constante que se suma al final.
+//  - Se prohíben los arcos más caros que los de una fuente obligada que cubre D.
+//  - Se eliminan los clientes sin demanda.
+class ReduccionProblema {
+private:
+    int numFuentesOriginal;
+    vector<int> fuenteOriginal;   // fuente del problema original de cada fuente reducida
+    double costoFijo;             // activación de las fuentes obligadas
+    int numFijadasAbiertas;
+    int numDominadas;
+    int numArcosProhibidos;
+    int numClientesEliminados;
+    int numCapacidadesAjustadas;
+
+public:
+    ReduccionProblema();
+
+    Problema reducir(const Problema& original);
+    vector<double> recuperarSolucion(const vector<double>& solucionReducida) const;
+    double recuperarCosto(double costoReducido) const;
+    ResultadoSolucion recuperar(const ResultadoSolucion& resultadoReducido) const;
+    bool reduceAlgo() const;
+    void imprimirResumen() const;
+
+    int obtenerFijadasAbiertas() const;
+    int obtenerDominadas() const;
+    int obtenerArcosProhibidos() const;
+    int obtenerClientesEliminados() const;
+    int obtenerCapacidadesAjustadas() const;
+};
+
+#endif // REDUCCION_PROBLEMA_H
@@ -0,0 +1,72 @@
+#include "ReglaRamificacion.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Desc: Lista las variables y_j fraccionarias, de la más a la menos fraccionaria.
+ *       Las variables fijadas en el nodo son enteras en el LP y nunca aparecen.
+ * Params:
+ *   - valoresY: Valores y_j de la relajación del nodo.
+ * Returns:
+ *   - vector<int>: Índices de las variables candidatas.
+ */
+vector<int> ReglaRamificacion::obtenerCandidatos(const vector<double>& valoresY) const {
+    vector<pair<double, int>> fracciones;
+    for (int j = 0; j < (int)valoresY.size(); j++) {
+        double fraccion = abs(valoresY[j] - round(valoresY[j]));
+        if (fraccion > 1e-6) {
+            fracciones.emplace_back(-fraccion, j);
+        }
+    }
+    sort(fracciones.begin(), fracciones.end());
+    vector<int> candidatos;
+    for (const auto& [fraccion, j] : fracciones) {
+        candidatos.push_back(j);
+    }
+    return candidatos;
+}
+
+/**
+ * Desc: Combina los aumentos de cota de ambas ramas con la regla del producto,
+ *       que favorece variables que mejoran las dos ramas y no solo una.
+ * Params:
+ *   - deltaAbajo: Aumento de la cota en la rama y_j = 0.
+ *   - deltaArriba: Aumento de la cota en la rama y_j = 1.
+ * Returns:
+ *   - double: Puntaje de la variable (mayor es mejor).
+ */
+double ReglaRamificacion::puntaje(double deltaAbajo, double deltaArriba) {
+    const double epsilon = 1e-6;
+    const double tope = 1e15;  // ramas infactibles
+    return max(min(deltaAbajo, tope), epsilon) * max(min(deltaArriba, tope), epsilon);
+}
+
+/**
+ * Desc: Elige la variable más fraccionaria.
+ * Params:
+ *   - modelo: Modelo LP del hilo (no se usa en esta regla).
+ *   - valoresY: Valores y_j de la relajación del nodo.
+ *   - base: Base óptima del nodo (no se usa en esta regla).
+ *   - cotaNodo: Cota inferior del nodo (no se usa en esta regla).
+ * Returns:
+ *   - int: Índice de la variable, o -1 si la solución es entera.
+ */
+int ReglaRamificacion::elegirVariable(ModeloRelajacionLP& /*modelo*/, const vector<double>& valoresY,
+                                      const unsigned char* /*base*/, double /*cotaNodo*/) {
+    vector<int> candidatos = obtenerCandidatos(valoresY);
+    return candidatos.empty() ? -1 : candidatos.front();
+}
+
+/**
+ * Desc: Recibe la cota obtenida por un hijo tras ramificar. La regla por defecto
+ *       no aprende nada de ella.
+ * Params:
+ *   - var: Variable por la que se ramificó.
+ *   - valor: Rama del hijo (0 o 1).
+ *   - valorPadre: Valor LP de la variable en el padre.
+ *   - cotaPadre: Cota inferior del padre.
+ *   - cotaHijo: Cota inferior del hijo.
+ * Returns: void
+ */
+void ReglaRamificacion::registrarRama(int /*var*/, int /*valor*/, double /*valorPadre*/, double /*cotaPadre*/,
+                                      double /*cotaHijo*/) {}
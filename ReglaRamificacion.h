@@ -0,0 +1,33 @@
+#ifndef REGLA_RAMIFICACION_H
+#define REGLA_RAMIFICACION_H
+
+#include "ModeloRelajacionLP.h"
+#include "NodoCompacto.h"
+#include <vector>
+#include <string>
+
+using namespace std;
+
+enum TipoRamificacion {
+    RAMA_MAS_FRACCIONARIA,  // y_j más cercana a 0.5
+    RAMA_FUERTE,            // prueba ambas ramas con pocas iteraciones del dual
+    RAMA_PSEUDOCOSTO,       // estima las ramas con los cambios de cota observados
+    RAMA_CONFIABILIDAD      // pseudo-costos, con ramificación fuerte mientras no sean confiables
+};
+
+// Regla por defecto: la variable más fraccionaria. Las demás reglas la especializan.
+class ReglaRamificacion {
+protected:
+    vector<int> obtenerCandidatos(const vector<double>& valoresY) const;
+    static double puntaje(double deltaAbajo, double deltaArriba);
+
+public:
+    virtual ~ReglaRamificacion() = default;
+
+    virtual int elegirVariable(ModeloRelajacionLP& modelo, const vector<double>& valoresY,
+                               const unsigned char* base, double cotaNodo);
+    virtual void registrarRama(int var, int valor, double valorPadre, double cotaPadre, double cotaHijo);
+    virtual string getNombre() const { return "Más fraccionaria"; }
+};
+
+#endif // REGLA_RAMIFICACION_H
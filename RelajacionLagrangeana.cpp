@@ -0,0 +1,315 @@
+#include "RelajacionLagrangeana.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/**
+ * Desc: Constructor de la relajación Lagrangeana.
+ * Params:
+ *   - iterRaiz: Iteraciones de subgradiente cuando se parte sin multiplicadores (raíz).
+ *   - iterNodo: Iteraciones cuando se heredan los multiplicadores del padre.
+ * Returns: void
+ */
+RelajacionLagrangeana::RelajacionLagrangeana(int iterRaiz, int iterNodo)
+    : numClientes(0), numFuentesProd(0), demandaTotal(0.0), construido(false), iteracionesRaiz(iterRaiz), iteracionesNodo(iterNodo),
+      mejorCota(-1e20), iteraciones(0) {}
+
+/**
+ * Desc: Copia los datos del problema en arreglos contiguos y reserva la memoria de trabajo.
+ * Params:
+ *   - problema: Referencia constante al problema.
+ * Returns: void
+ */
+void RelajacionLagrangeana::construir(const Problema& problema) {
+    numClientes = problema.getNumClientes();
+    numFuentesProd = problema.getNumFuentesProd();
+    demandas = problema.getDemandas();
+    capacidades = problema.getCapacidades();
+    costosActivacion.resize(numFuentesProd);
+    VistaCostos matriz = problema.getMatrizCostos();
+    costos.assign(matriz.begin(), matriz.end());
+    demandaTotal = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        demandaTotal += demandas[i];
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        costosActivacion[j] = problema.getCostoActivacion(j);
+    }
+
+    multiplicadores.assign(numClientes, 0.0);
+    mejoresMultiplicadores.assign(numClientes, 0.0);
+    subgradiente.assign(numClientes, 0.0);
+    y.assign(numFuentesProd, 0.0);
+    mejorY.assign(numFuentesProd, 0.0);
+    valorFuente.assign(numFuentesProd, 0.0);
+    mejorValorFuente.assign(numFuentesProd, 0.0);
+    candidatos.reserve(max(numClientes, numFuentesProd));
+    construido = true;
+}
+
+/**
+ * Desc: Indica si la relajación ya fue construida para algún problema.
+ * Params: void
+ * Returns:
+ *   - bool: True si construir() ya fue llamado.
+ */
+bool RelajacionLagrangeana::estaConstruido() const { return construido; }
+
+/**
+ * Desc: Calcula una cota inferior del nodo dualizando las restricciones de demanda
+ *       sum_j x_ij = d_i con multiplicadores lambda_i. El subproblema se separa en una
+ *       mochila continua por fuente (clientes con c_ij - lambda_i < 0, x_ij <= d_i,
+ *       hasta M_j) más una mochila continua sobre las y_j con sum_j M_j y_j >= D.
+ *       Los multiplicadores se ajustan por subgradiente con paso de Polyak.
+ * Params:
+ *   - nodo: Nodo con las variables y_j fijadas.
+ *   - multiplicadoresIniciales: Multiplicadores del padre tal como quedaron en el
+ *     AlmacenBases (nullptr en la raíz).
+ *   - cotaSuperior: Mejor solución conocida, para el paso y para cortar temprano.
+ * Returns:
+ *   - bool: False si las fuentes no cerradas no alcanzan a cubrir la demanda.
+ */
+bool RelajacionLagrangeana::resolver(const NodoCompacto& nodo, const unsigned char* multiplicadoresIniciales, double cotaSuperior) {
+    const uint64_t* cero = nodo.fijadasCero();
+    double capacidadDisponible = 0.0;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (!(cero[j / 64] & (uint64_t(1) << (j % 64)))) {
+            capacidadDisponible += capacidades[j];
+        }
+    }
+    if (capacidadDisponible < demandaTotal - 1e-9) {
+        return false;
+    }
+
+    int maxIter = iteracionesNodo;
+    if (multiplicadoresIniciales) {
+        memcpy(multiplicadores.data(), multiplicadoresIniciales, tamanoMultiplicadores());
+    } else {
+        inicializarMultiplicadores(nodo);
+        maxIter = iteracionesRaiz;
+    }
+
+    mejorCota = -1e20;
+    double theta = 2.0;
+    int sinMejora = 0;
+    for (iteraciones = 0; iteraciones < maxIter; iteraciones++) {
+        double cota = evaluarSubproblema(nodo);
+        if (cota > mejorCota + 1e-9) {
+            mejorCota = cota;
+            mejoresMultiplicadores = multiplicadores;
+            mejorY = y;
+            mejorValorFuente = valorFuente;
+            sinMejora = 0;
+        } else if (++sinMejora >= 10) {
+            theta /= 2.0;
+            sinMejora = 0;
+        }
+
+        double norma = 0.0;
+        for (double g : subgradiente) {
+            norma += g * g;
+        }
+        // Subgradiente nulo: la solución del subproblema es factible y la cota es exacta
+        if (norma < 1e-12 || mejorCota >= cotaSuperior - 1e-9 || theta < 1e-4) {
+            iteraciones++;
+            break;
+        }
+
+        double objetivo = cotaSuperior < 1e19 ? cotaSuperior : abs(mejorCota) * 1.05 + 1.0;
+        double paso = theta * (objetivo - cota) / norma;
+        for (int i = 0; i < numClientes; i++) {
+            multiplicadores[i] += paso * subgradiente[i];
+        }
+    }
+    return true;
+}
+
+/**
+ * Desc: Multiplicadores iniciales: para cada cliente, su menor costo de envío
+ *       entre las fuentes no cerradas (el precio al que lo atendería su mejor fuente).
+ * Params:
+ *   - nodo: Nodo con las variables y_j fijadas.
+ * Returns: void
+ */
+void RelajacionLagrangeana::inicializarMultiplicadores(const NodoCompacto& nodo) {
+    const uint64_t* cero = nodo.fijadasCero();
+    for (int i = 0; i < numClientes; i++) {
+        double minimo = 1e20;
+        for (int j = 0; j < numFuentesProd; j++) {
+            if (!(cero[j / 64] & (uint64_t(1) << (j % 64)))) {
+                minimo = min(minimo, costos[i*numFuentesProd + j]);
+            }
+        }
+        multiplicadores[i] = minimo < 1e20 ? minimo : 0.0;
+    }
+}
+
+/**
+ * Desc: Resuelve el subproblema Lagrangeano para los multiplicadores actuales.
+ *       Deja en y, valorFuente y subgradiente la solución encontrada.
+ * Params:
+ *   - nodo: Nodo con las variables y_j fijadas.
+ * Returns:
+ *   - double: Valor de la función dual L(lambda).
+ */
+double RelajacionLagrangeana::evaluarSubproblema(const NodoCompacto& nodo) {
+    const uint64_t* cero = nodo.fijadasCero();
+    const uint64_t* uno = nodo.fijadasUno();
+
+    double cota = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        cota += multiplicadores[i] * demandas[i];
+        subgradiente[i] = demandas[i];
+    }
+
+    // Mochila continua por fuente: costo de abrirla y atender a sus clientes más rentables
+    for (int j = 0; j < numFuentesProd; j++) {
+        valorFuente[j] = 0.0;
+        if (cero[j / 64] & (uint64_t(1) << (j % 64))) {
+            continue;
+        }
+        candidatos.clear();
+        for (int i = 0; i < numClientes; i++) {
+            double reducido = costos[i*numFuentesProd + j] - multiplicadores[i];
+            if (reducido < 0.0) {
+                candidatos.emplace_back(reducido, i);
+            }
+        }
+        sort(candidatos.begin(), candidatos.end());
+        double capRestante = capacidades[j];
+        double valor = costosActivacion[j];
+        for (const auto& [reducido, i] : candidatos) {
+            if (capRestante <= 0.0) {
+                break;
+            }
+            double x = min(demandas[i], capRestante);
+            valor += reducido * x;
+            capRestante -= x;
+        }
+        valorFuente[j] = valor;
+    }
+
+    // Mochila continua sobre las y_j: abrir las rentables y cubrir la demanda total
+    double capAbierta = 0.0;
+    candidatos.clear();
+    for (int j = 0; j < numFuentesProd; j++) {
+        uint64_t bit = uint64_t(1) << (j % 64);
+        if (cero[j / 64] & bit) {
+            y[j] = 0.0;
+        } else if ((uno[j / 64] & bit) || valorFuente[j] < 0.0) {
+            y[j] = 1.0;
+            capAbierta += capacidades[j];
+        } else {
+            y[j] = 0.0;
+            candidatos.emplace_back(valorFuente[j] / capacidades[j], j);
+        }
+    }
+    if (capAbierta < demandaTotal) {
+        sort(candidatos.begin(), candidatos.end());
+        for (const auto& [razon, j] : candidatos) {
+            if (capAbierta >= demandaTotal) {
+                break;
+            }
+            y[j] = min(1.0, (demandaTotal - capAbierta) / capacidades[j]);
+            capAbierta += y[j] * capacidades[j];
+        }
+    }
+
+    // Valor dual y subgradiente d_i - sum_j x_ij (con x escalado por y_j)
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (y[j] <= 0.0) {
+            continue;
+        }
+        cota += valorFuente[j] * y[j];
+        double capRestante = capacidades[j];
+        candidatos.clear();
+        for (int i = 0; i < numClientes; i++) {
+            double reducido = costos[i*numFuentesProd + j] - multiplicadores[i];
+            if (reducido < 0.0) {
+                candidatos.emplace_back(reducido, i);
+            }
+        }
+        sort(candidatos.begin(), candidatos.end());
+        for (const auto& [reducido, i] : candidatos) {
+            if (capRestante <= 0.0) {
+                break;
+            }
+            double x = min(demandas[i], capRestante);
+            subgradiente[i] -= x * y[j];
+            capRestante -= x;
+        }
+    }
+    return cota;
+}
+
+/**
+ * Desc: Devuelve la mejor cota Lagrangeana del último solve.
+ * Params: void
+ * Returns:
+ *   - double: Cota inferior del nodo.
+ */
+double RelajacionLagrangeana::obtenerValorObjetivo() const { return mejorCota; }
+
+/**
+ * Desc: Devuelve las y_j de la mejor iteración del último solve.
+ * Params: void
+ * Returns:
+ *   - const double*: Puntero a los numFuentesProd valores.
+ */
+const double* RelajacionLagrangeana::obtenerValoresY() const { return mejorY.data(); }
+
+/**
+ * Desc: Devuelve los multiplicadores de la mejor iteración, para que los hereden los hijos.
+ * Params: void
+ * Returns:
+ *   - const double*: Puntero a los numClientes multiplicadores.
+ */
+const double* RelajacionLagrangeana::obtenerMultiplicadores() const { return mejoresMultiplicadores.data(); }
+
+/**
+ * Desc: Devuelve cuántos bytes ocupan los multiplicadores de un nodo.
+ *       Se guardan en el mismo AlmacenBases que usaría la base LP.
+ * Params: void
+ * Returns:
+ *   - size_t: Bytes por vector de multiplicadores.
+ */
+size_t RelajacionLagrangeana::tamanoMultiplicadores() const { return numClientes * sizeof(double); }
+
+/**
+ * Desc: Devuelve las iteraciones de subgradiente del último solve.
+ * Params: void
+ * Returns:
+ *   - int: Iteraciones realizadas.
+ */
+int RelajacionLagrangeana::obtenerIteraciones() const { return iteraciones; }
+
+/**
+ * Desc: Elige la variable de ramificación: la y_j libre más fraccionaria y, si todas
+ *       son enteras, la fuente libre cuyo valor en la mochila está más cerca de cero
+ *       (la decisión de abrirla es la más dudosa).
+ * Params:
+ *   - nodo: Nodo con las variables y_j fijadas.
+ * Returns:
+ *   - int: Índice de la variable, o -1 si todas están fijadas.
+ */
+int RelajacionLagrangeana::elegirVariable(const NodoCompacto& nodo) const {
+    int varFrac = -1;
+    int varDudosa = -1;
+    double maxFraccion = 1e-6;
+    double minValor = 1e20;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (nodo.estaFijada(j)) {
+            continue;
+        }
+        double fraccion = abs(mejorY[j] - round(mejorY[j]));
+        if (fraccion > maxFraccion) {
+            maxFraccion = fraccion;
+            varFrac = j;
+        }
+        if (abs(mejorValorFuente[j]) < minValor) {
+            minValor = abs(mejorValorFuente[j]);
+            varDudosa = j;
+        }
+    }
+    return varFrac != -1 ? varFrac : varDudosa;
+}
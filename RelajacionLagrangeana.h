@@ -0,0 +1,55 @@
+#ifndef RELAJACION_LAGRANGEANA_H
+#define RELAJACION_LAGRANGEANA_H
+
+#include "Problema.h"
+#include "NodoCompacto.h"
+#include <vector>
+
+using namespace std;
+
+class RelajacionLagrangeana {
+private:
+    int numClientes;
+    int numFuentesProd;
+    double demandaTotal;
+    bool construido;
+    vector<double> costos;          // c[i][j] en orden fila por cliente
+    vector<double> demandas;
+    vector<double> capacidades;
+    vector<double> costosActivacion;
+    int iteracionesRaiz;
+    int iteracionesNodo;
+
+    // Resultado de la mejor iteración del último solve
+    double mejorCota;
+    vector<double> mejoresMultiplicadores;
+    vector<double> mejorY;
+    vector<double> mejorValorFuente;
+    int iteraciones;
+
+    // Memoria de trabajo reutilizada entre llamadas
+    vector<double> multiplicadores;
+    vector<double> y;
+    vector<double> valorFuente;
+    vector<double> subgradiente;
+    vector<pair<double, int>> candidatos;
+
+    double evaluarSubproblema(const NodoCompacto& nodo);
+    void inicializarMultiplicadores(const NodoCompacto& nodo);
+
+public:
+    RelajacionLagrangeana(int iterRaiz = 300, int iterNodo = 40);
+
+    void construir(const Problema& problema);
+    bool estaConstruido() const;
+    bool resolver(const NodoCompacto& nodo, const unsigned char* multiplicadoresIniciales, double cotaSuperior);
+
+    double obtenerValorObjetivo() const;
+    const double* obtenerValoresY() const;
+    const double* obtenerMultiplicadores() const;
+    size_t tamanoMultiplicadores() const;
+    int obtenerIteraciones() const;
+    int elegirVariable(const NodoCompacto& nodo) const;
+};
+
+#endif // RELAJACION_LAGRANGEANA_H
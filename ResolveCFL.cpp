@@ -1,4 +1,5 @@
 #include "ResolveCFL.h"
+#include <chrono>
 
 /**
  * Desc: Constructor de la clase ResolveCFL.
@@ -7,16 +8,19 @@
  *   - strategy: Puntero compartido a la estrategia de resolución (por ejemplo, Branch and Bound).
  * Returns: void
  */
-ResolveCFL::ResolveCFL(shared_ptr<StrategyResolucion> Strategy) : Strategy(Strategy) {}
+ResolveCFL::ResolveCFL(shared_ptr<StrategyResolucion> Strategy) : Strategy(Strategy), usarReduccion(true), estrategiaAlDia(false) {}
 
 /**
  * Desc: Resuelve el problema utilizando la estrategia de resolución actual.
- *       Llama al método `resolver` de la estrategia asignada.
+ *       Si hay caché, primero busca un resultado guardado para el mismo contenido
+ *       del problema y los mismos parámetros; si no lo hay, resuelve y guarda el
+ *       resultado, salvo que haya terminado por tiempo o memoria (no se repetiría).
  * Params:
  *   - problema: Referencia constante al problema a resolver.
  * Returns:
  *   - ResultadoSolucion: Estructura con los resultados del problema resuelto,
- *                         incluyendo solución, costo y tiempo de ejecución.
+ *                         incluyendo solución, costo y tiempo de ejecución. Si viene
+ *                         de la caché, el tiempo es el de la búsqueda.
  * Throws:
  *   - runtime_error: Si no se ha establecido ninguna estrategia de resolución.
  */
@@ -24,8 +28,61 @@ ResultadoSolucion ResolveCFL::resolver(const Problema& problema) {
     if (!Strategy) {
         throw runtime_error("No se ha establecido una estrategia de resolución");
     }
-    
-    return Strategy->resolver(problema);
+    problemaActual = make_shared<Problema>(problema);
+    estrategiaAlDia = false;
+    if (!cache) {
+        return resolverSinCache(problema);
+    }
+
+    auto inicio = chrono::high_resolution_clock::now();
+    uint64_t huella = problema.calcularHuella();
+    string parametros = Strategy->getParametros() + (usarReduccion ? " reduccion=1" : " reduccion=0");
+    ResultadoSolucion resultado;
+    if (cache->buscar(huella, parametros, resultado)) {
+        resultado.desdeCache = true;
+        resultado.tiempoEjecucion =
+            chrono::duration<double>(chrono::high_resolution_clock::now() - inicio).count();
+        cout << "Resultado recuperado de la caché (" << cache->getDirectorio() << ")\n";
+        return resultado;
+    }
+
+    resultado = resolverSinCache(problema);
+    bool repetible = resultado.motivoTerminacion != TERMINO_LIMITE_TIEMPO &&
+                     resultado.motivoTerminacion != TERMINO_LIMITE_MEMORIA;
+    if (repetible) {
+        try {
+            cache->guardar(huella, parametros, resultado);
+        } catch (const exception& e) {
+            cerr << "Advertencia: " << e.what() << "\n";
+        }
+    }
+    return resultado;
+}
+
+/**
+ * Desc: Resuelve el problema con la estrategia actual sin pasar por la caché.
+ *       Salvo que se desactive, primero reduce el problema (presolve), llama al
+ *       método `resolver` de la estrategia sobre el reducido y lleva el resultado
+ *       de vuelta al problema original.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns:
+ *   - ResultadoSolucion: Resultado sobre el problema original.
+ */
+ResultadoSolucion ResolveCFL::resolverSinCache(const Problema& problema) {
+    if (!usarReduccion) {
+        estrategiaAlDia = true;
+        return Strategy->resolver(problema);
+    }
+
+    ReduccionProblema reduccion;
+    Problema reducido = reduccion.reducir(problema);
+    if (!reduccion.reduceAlgo()) {
+        estrategiaAlDia = true;
+        return Strategy->resolver(problema);
+    }
+    reduccion.imprimirResumen();
+    return reduccion.recuperar(Strategy->resolver(reducido));
 }
 
 /**
@@ -37,4 +94,67 @@ ResultadoSolucion ResolveCFL::resolver(const Problema& problema) {
  */
 string ResolveCFL::getNombreStrategy() const {
     return Strategy ? Strategy->getNombre() : "Sin estrategia";
-}
\ No newline at end of file
+}
+/**
+ * Desc: Activa o desactiva la reducción del problema antes de resolverlo.
+ * Params:
+ *   - activa: True para reducir (por defecto), False para resolver el problema tal cual.
+ * Returns: void
+ */
+void ResolveCFL::setReduccion(bool activa) { usarReduccion = activa; }
+
+/**
+ * Desc: Asigna la caché de resultados que consulta `resolver`.
+ * Params:
+ *   - cache: Caché a usar; nullptr la desactiva (por defecto).
+ * Returns: void
+ */
+void ResolveCFL::setCache(shared_ptr<CacheResultados> cache) { this->cache = cache; }
+
+/**
+ * Desc: Aplica un cambio de demandas o costos de activación al último problema
+ *       resuelto y lo vuelve a resolver aprovechando esa resolución (incumbente,
+ *       base y cortes de la raíz, cota global; ver StrategyResolucion::reoptimizar).
+ *       No se reduce el problema ni se consulta la caché: la reducción cambiaría la
+ *       formulación que la estrategia guardó. Si la estrategia resolvió la última vez
+ *       un problema reducido o el resultado vino de la caché, se resuelve desde cero
+ *       sin reducir y las siguientes reoptimizaciones ya parten de ahí.
+ * Params:
+ *   - cambio: Nuevas demandas y costos de activación.
+ * Returns:
+ *   - ResultadoSolucion: Resultado sobre el problema modificado, que pasa a ser el actual.
+ * Throws:
+ *   - runtime_error: Si no hay estrategia, no se ha resuelto ningún problema o el
+ *                    cambio es inválido.
+ */
+ResultadoSolucion ResolveCFL::reoptimizar(const CambioProblema& cambio) {
+    if (!Strategy) {
+        throw runtime_error("No se ha establecido una estrategia de resolución");
+    }
+    if (!problemaActual) {
+        throw runtime_error("No hay un problema resuelto para reoptimizar");
+    }
+    auto modificado = make_shared<Problema>(*problemaActual);
+    modificado->aplicarCambio(cambio);
+    bool aprovechar = estrategiaAlDia;
+    problemaActual = modificado;
+    estrategiaAlDia = false;
+    ResultadoSolucion resultado = aprovechar ? Strategy->reoptimizar(*modificado, cambio) : Strategy->resolver(*modificado);
+    estrategiaAlDia = true;
+    return resultado;
+}
+
+/**
+ * Desc: Devuelve el último problema resuelto, con los cambios aplicados por reoptimizar.
+ * Params: void
+ * Returns:
+ *   - const Problema&: Problema actual.
+ * Throws:
+ *   - runtime_error: Si todavía no se ha resuelto ningún problema.
+ */
+const Problema& ResolveCFL::getProblemaActual() const {
+    if (!problemaActual) {
+        throw runtime_error("No hay un problema resuelto");
+    }
+    return *problemaActual;
+}
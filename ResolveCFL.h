@@ -2,6 +2,8 @@
 #define RESUELVE_CFL_H
 
 #include "StrategyResolucion.h"
+#include "ReduccionProblema.h"
+#include "CacheResultados.h"
 #include <memory>
 #include <stdexcept>
 
@@ -10,12 +12,22 @@ using namespace std;
 class ResolveCFL {
 private:
     shared_ptr<StrategyResolucion> Strategy;
+    bool usarReduccion;
+    shared_ptr<CacheResultados> cache;
+    shared_ptr<Problema> problemaActual;  // último problema resuelto (comparte la matriz de costos)
+    bool estrategiaAlDia;                 // la estrategia resolvió problemaActual tal cual (sin reducir)
+
+    ResultadoSolucion resolverSinCache(const Problema& problema);
 
 public:
     ResolveCFL(shared_ptr<StrategyResolucion> Strategy);
     
     ResultadoSolucion resolver(const Problema& problema);
+    ResultadoSolucion reoptimizar(const CambioProblema& cambio);
+    const Problema& getProblemaActual() const;
     string getNombreStrategy() const;
+    void setReduccion(bool activa);
+    void setCache(shared_ptr<CacheResultados> cache);
 };
 
 #endif // RESUELVE_CFL_H
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "ResolvedorEscenarios.h"
+#include "ArchivoMapeado.h"
+#include "LectorInstancia.h"
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
+
+/**
+ * Desc: Constructor del resolvedor de escenarios.
+ * Params:
+ *   - base: Problema con las fuentes, capacidades, costos y demandas de referencia.
+ *   - maxIter: Máximo de nodos por escenario.
+ *   - tol: Tolerancia de optimalidad.
+ *   - hilos: Escenarios resueltos a la vez; 0 o menos usa todos los núcleos.
+ * Returns: void
+ */
+ResolvedorEscenarios::ResolvedorEscenarios(const Problema& base, int maxIter, double tol, int hilos)
+    : base(base), maxIteraciones(maxIter), tolerancia(tol), numHilos(hilos), limiteTiempo(0.0), limiteMemoria(0.0) {
+    if (numHilos <= 0) {
+        numHilos = max(1u, thread::hardware_concurrency());
+    }
+}
+
+/**
+ * Desc: Verifica que cada escenario tenga una demanda no negativa por cliente.
+ * Params:
+ *   - demandas: Vectores de demanda de los escenarios.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si algún escenario no calza con el problema base.
+ */
+void ResolvedorEscenarios::validar(const vector<vector<double>>& demandas) const {
+    for (size_t k = 0; k < demandas.size(); k++) {
+        if (demandas[k].size() != size_t(base.getNumClientes())) {
+            throw runtime_error("El escenario " + to_string(k + 1) + " tiene " + to_string(demandas[k].size()) +
+                                " demandas; se esperaban " + to_string(base.getNumClientes()));
+        }
+        for (double demanda : demandas[k]) {
+            if (demanda < 0) {
+                throw runtime_error("El escenario " + to_string(k + 1) + " tiene una demanda negativa");
+            }
+        }
+    }
+}
+
+/**
+ * Desc: Resuelve todos los escenarios repartiéndolos entre los hilos a medida que se
+ *       desocupan. Cada hilo resuelve su primer escenario desde cero y los siguientes
+ *       con StrategyBranchAndBound::reoptimizar, pasándole solo las demandas que
+ *       difieren de su escenario anterior. Cada resultado se entrega apenas termina.
+ * Params:
+ *   - demandas: Un vector de demandas (una por cliente) por escenario.
+ *   - alTerminar: Se llama con el índice del escenario y su resultado, en el orden
+ *                 en que terminan; las llamadas nunca se solapan.
+ * Returns: void
+ * Throws:
+ *   - runtime_error: Si algún escenario no calza con el problema base (antes de
+ *                    resolver ninguno).
+ *   - El primer error de un hilo (o de alTerminar), después de que terminen los demás.
+ */
+void ResolvedorEscenarios::resolver(const vector<vector<double>>& demandas,
+                                    const function<void(int, const ResultadoSolucion&)>& alTerminar) const {
+    validar(demandas);
+    atomic<size_t> siguiente(0);
+    mutex mtxEntrega;
+    exception_ptr falla;
+    auto trabajador = [&]() {
+        try {
+            StrategyBranchAndBound estrategia(base, maxIteraciones, tolerancia);
+            estrategia.setLimiteTiempo(limiteTiempo);
+            estrategia.setLimiteMemoria(limiteMemoria);
+            estrategia.setIntervaloProgreso(0);
+            Problema escenario = base;  // el escenario anterior de este hilo
+            bool primero = true;
+            size_t k;
+            while ((k = siguiente++) < demandas.size()) {
+                CambioProblema cambio;
+                for (int i = 0; i < escenario.getNumClientes(); i++) {
+                    if (demandas[k][i] != escenario.getDemanda(i)) {
+                        cambio.demandas.emplace_back(i, demandas[k][i]);
+                    }
+                }
+                escenario.aplicarCambio(cambio);
+                ResultadoSolucion resultado =
+                    primero ? estrategia.resolver(escenario) : estrategia.reoptimizar(escenario, cambio);
+                primero = false;
+                lock_guard<mutex> lock(mtxEntrega);
+                alTerminar(int(k), resultado);
+            }
+        } catch (...) {
+            // Se deja de repartir escenarios y el error se relanza al terminar los demás hilos
+            lock_guard<mutex> lock(mtxEntrega);
+            if (!falla) {
+                falla = current_exception();
+            }
+            siguiente = demandas.size();
+        }
+    };
+    vector<thread> hilos;
+    for (int h = 0; h < min(numHilos, (int)demandas.size()); h++) {
+        hilos.emplace_back(trabajador);
+    }
+    for (auto& hilo : hilos) {
+        hilo.join();
+    }
+    if (falla) {
+        rethrow_exception(falla);
+    }
+}
+
+/**
+ * Desc: Fija un límite de tiempo por escenario.
+ * Params:
+ *   - segundos: Tiempo máximo; 0 o menos quita el límite.
+ * Returns: void
+ */
+void ResolvedorEscenarios::setLimiteTiempo(double segundos) { limiteTiempo = segundos; }
+
+/**
+ * Desc: Fija un límite a la memoria de los nodos abiertos de cada escenario.
+ * Params:
+ *   - megabytes: Límite en MB; 0 o menos lo quita.
+ * Returns: void
+ */
+void ResolvedorEscenarios::setLimiteMemoria(double megabytes) { limiteMemoria = megabytes; }
+
+/**
+ * Desc: Devuelve cuántos escenarios se resuelven a la vez.
+ * Params: void
+ * Returns:
+ *   - int: Número de hilos.
+ */
+int ResolvedorEscenarios::getNumHilos() const { return numHilos; }
+
+/**
+ * Desc: Lee un archivo de escenarios: vectores de demanda de numClientes números
+ *       cada uno, uno tras otro (por convención, uno por línea) hasta el fin del archivo.
+ * Params:
+ *   - nombreArchivo: Archivo de texto con los escenarios.
+ *   - numClientes: Demandas por escenario.
+ * Returns:
+ *   - vector<vector<double>>: Demandas de cada escenario, en orden.
+ * Throws:
+ *   - runtime_error: Si el archivo no se puede leer o un escenario queda incompleto.
+ */
+vector<vector<double>> ResolvedorEscenarios::leerEscenarios(const string& nombreArchivo, int numClientes) {
+    ArchivoMapeado archivo(nombreArchivo);
+    LectorInstancia lector(reinterpret_cast<const char*>(archivo.obtenerDatos()), archivo.obtenerTamano(), nombreArchivo);
+    vector<vector<double>> escenarios;
+    while (lector.quedanDatos()) {
+        escenarios.emplace_back(numClientes);
+        lector.leerReales(escenarios.back().data(), numClientes,
+                          "demanda del escenario " + to_string(escenarios.size()));
+    }
+    return escenarios;
+}
@@ -0,0 +1,39 @@
+#ifndef RESOLVEDOR_ESCENARIOS_H
+#define RESOLVEDOR_ESCENARIOS_H
+
+#include "StrategyBranchAndBound.h"
+#include <functional>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+// Resuelve muchos escenarios de demanda sobre las mismas fuentes y costos. Cada
+// hilo mantiene una sola estrategia secuencial: construye su relajación una vez y
+// pasa de un escenario al siguiente cambiando solo las filas de demanda (con la
+// base, el incumbente y la cota de su escenario anterior). Los escenarios son
+// copias del problema base que comparten su matriz de costos.
+class ResolvedorEscenarios {
+private:
+    Problema base;
+    int maxIteraciones;
+    double tolerancia;
+    int numHilos;
+    double limiteTiempo;
+    double limiteMemoria;
+
+    void validar(const vector<vector<double>>& demandas) const;
+
+public:
+    ResolvedorEscenarios(const Problema& base, int maxIter, double tol, int hilos = 0);
+
+    void resolver(const vector<vector<double>>& demandas,
+                  const function<void(int, const ResultadoSolucion&)>& alTerminar) const;
+    void setLimiteTiempo(double segundos);
+    void setLimiteMemoria(double megabytes);
+    int getNumHilos() const;
+
+    static vector<vector<double>> leerEscenarios(const string& nombreArchivo, int numClientes);
+};
+
+#endif // RESOLVEDOR_ESCENARIOS_H
@@ -0,0 +1,286 @@
+#include "SeparadorCortes.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Desc: Constructor del separador de cortes.
+ * Params:
+ *   - maxRondas: Máximo de rondas de separación en la raíz.
+ *   - mejoraMinima: Mejora relativa de la cota bajo la cual se considera estancada.
+ *   - maxCortesRonda: Máximo de cortes de cota variable agregados por ronda.
+ * Returns: void
+ */
+SeparadorCortes::SeparadorCortes(int maxRondas, double mejoraMinima, int maxCortesRonda)
+    : numClientes(0), numFuentesProd(0), numVarX(0), demandaTotal(0.0), capacidadTotal(0.0), maxRondas(maxRondas),
+      mejoraMinima(mejoraMinima), maxCortesRonda(maxCortesRonda), rondas(0), cotaInicial(0.0), cotaFinal(0.0) {}
+
+/**
+ * Desc: Copia del problema los datos que necesitan las familias de cortes.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns: void
+ */
+void SeparadorCortes::construir(const Problema& problema) {
+    numClientes = problema.getNumClientes();
+    numFuentesProd = problema.getNumFuentesProd();
+    numVarX = numClientes * numFuentesProd;
+    demandas = problema.getDemandas();
+    capacidades = problema.getCapacidades();
+    demandaTotal = 0.0;
+    for (double d : demandas) {
+        demandaTotal += d;
+    }
+    capacidadTotal = 0.0;
+    for (double M : capacidades) {
+        capacidadTotal += M;
+    }
+    flujo.assign(numFuentesProd, 0.0);
+}
+
+/**
+ * Desc: Separa en la raíz: resuelve el LP, agrega los cortes violados por su solución
+ *       y vuelve a resolver desde la base anterior, hasta que no haya cortes violados,
+ *       la cota deje de mejorar o se alcance el máximo de rondas.
+ *       Los cortes quedan en el modelo y en el pool, para cargarlos en otros modelos.
+ * Params:
+ *   - modelo: Modelo LP persistente, ya construido para el problema.
+ *   - pool: Pool donde se guardan los cortes agregados.
+ * Returns:
+ *   - bool: False si la relajación de la raíz es infactible.
+ */
+bool SeparadorCortes::separarRaiz(ModeloRelajacionLP& modelo, PoolCortes& pool) {
+    rondas = 0;
+    if (!modelo.resolver(map<int, int>(), vector<unsigned char>())) {
+        return false;
+    }
+    cotaInicial = cotaFinal = modelo.obtenerValorObjetivo();
+
+    while (rondas < maxRondas) {
+        int desde = pool.numCortes();
+        if (separar(modelo.obtenerValoresX(), modelo.obtenerValoresY(), pool) == 0) {
+            break;
+        }
+        modelo.agregarCortes(pool, desde);
+        rondas++;
+        if (!modelo.resolver(map<int, int>(), vector<unsigned char>())) {
+            return false;
+        }
+        double cota = modelo.obtenerValorObjetivo();
+        bool estancada = cota - cotaFinal <= mejoraMinima * max(1.0, abs(cotaFinal));
+        cotaFinal = cota;
+        if (estancada) {
+            break;
+        }
+    }
+    return true;
+}
+
+/**
+ * Desc: Ejecuta una ronda de las tres familias sobre una solución LP.
+ * Params:
+ *   - x: Valores x_ij (posición i*numFuentesProd + j).
+ *   - y: Valores y_j.
+ *   - pool: Pool donde se agregan los cortes violados.
+ * Returns:
+ *   - int: Número de cortes agregados.
+ */
+int SeparadorCortes::separar(const double* x, const double* y, PoolCortes& pool) {
+    return separarCotaVariable(x, y, pool) + separarCobertura(y, pool) + separarCoberturaFlujo(x, y, pool);
+}
+
+/**
+ * Desc: Separa las desigualdades desagregadas x_ij <= min(d_i, M_j) y_j, que la fila
+ *       agregada de capacidad no impone. Se agregan las más violadas primero.
+ * Params:
+ *   - x: Valores x_ij.
+ *   - y: Valores y_j.
+ *   - pool: Pool donde se agregan los cortes.
+ * Returns:
+ *   - int: Número de cortes agregados.
+ */
+int SeparadorCortes::separarCotaVariable(const double* x, const double* y, PoolCortes& pool) {
+    orden.clear();
+    for (int i = 0; i < numClientes; ++i) {
+        for (int j = 0; j < numFuentesProd; ++j) {
+            double violacion = x[i*numFuentesProd + j] - min(demandas[i], capacidades[j]) * y[j];
+            if (violacion > 1e-6) {
+                orden.emplace_back(-violacion, i*numFuentesProd + j);
+            }
+        }
+    }
+    int numCortes = min((int)orden.size(), maxCortesRonda);
+    partial_sort(orden.begin(), orden.begin() + numCortes, orden.end());
+    for (int k = 0; k < numCortes; ++k) {
+        int i = orden[k].second / numFuentesProd;
+        int j = orden[k].second % numFuentesProd;
+        pool.agregar(CORTE_COTA_VARIABLE, {orden[k].second, numVarX + j}, {1.0, -min(demandas[i], capacidades[j])},
+                     -COIN_DBL_MAX, 0.0);
+    }
+    return numCortes;
+}
+
+/**
+ * Desc: Separa una desigualdad de cobertura sobre la capacidad total sum_j M_j y_j >= D.
+ *       Un conjunto C cuyo cierre deja menos capacidad que la demanda obliga a abrir
+ *       al menos una de sus fuentes: sum_{j en C} y_j >= 1. C se elige con la regla
+ *       golosa y*_j / M_j y luego se reduce a una cobertura minimal.
+ * Params:
+ *   - y: Valores y_j.
+ *   - pool: Pool donde se agrega el corte.
+ * Returns:
+ *   - int: 1 si se agregó un corte, 0 si no.
+ */
+int SeparadorCortes::separarCobertura(const double* y, PoolCortes& pool) {
+    double holgura = capacidadTotal - demandaTotal;
+    if (holgura < 0) {
+        return 0;
+    }
+    vector<double> claves(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; ++j) {
+        claves[j] = y[j] / capacidades[j];
+    }
+    vector<int> cobertura = elegirCobertura(claves, holgura);
+    if (cobertura.empty()) {
+        return 0;
+    }
+
+    // Quitar las fuentes más abiertas mientras C siga siendo cobertura
+    sort(cobertura.begin(), cobertura.end(), [y](int a, int b) { return y[a] > y[b]; });
+    double peso = 0.0;
+    for (int j : cobertura) {
+        peso += capacidades[j];
+    }
+    vector<int> minimal;
+    for (int j : cobertura) {
+        if (peso - capacidades[j] > holgura + 1e-9) {
+            peso -= capacidades[j];
+        } else {
+            minimal.push_back(j);
+        }
+    }
+
+    double suma = 0.0;
+    for (int j : minimal) {
+        suma += y[j];
+    }
+    if (suma >= 1.0 - 1e-6) {
+        return 0;
+    }
+    vector<int> idx;
+    for (int j : minimal) {
+        idx.push_back(numVarX + j);
+    }
+    pool.agregar(CORTE_COBERTURA, idx, vector<double>(idx.size(), 1.0), 1.0, COIN_DBL_MAX);
+    return 1;
+}
+
+/**
+ * Desc: Separa una desigualdad de cobertura de flujo sobre sum_j x_j <= D, con
+ *       x_j = sum_i x_ij <= M_j y_j. Para C con lambda = sum_{j en C} M_j - D > 0:
+ *       sum_{j en C} x_j + sum_{j en C} (M_j - lambda)^+ (1 - y_j) <= D.
+ *       C se elige con la regla golosa (1 - y*_j) / M_j.
+ * Params:
+ *   - x: Valores x_ij.
+ *   - y: Valores y_j.
+ *   - pool: Pool donde se agrega el corte.
+ * Returns:
+ *   - int: 1 si se agregó un corte, 0 si no.
+ */
+int SeparadorCortes::separarCoberturaFlujo(const double* x, const double* y, PoolCortes& pool) {
+    fill(flujo.begin(), flujo.end(), 0.0);
+    for (int i = 0; i < numClientes; ++i) {
+        for (int j = 0; j < numFuentesProd; ++j) {
+            flujo[j] += x[i*numFuentesProd + j];
+        }
+    }
+    vector<double> claves(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; ++j) {
+        claves[j] = (1.0 - y[j]) / capacidades[j];
+    }
+    vector<int> cobertura = elegirCobertura(claves, demandaTotal);
+    if (cobertura.empty()) {
+        return 0;
+    }
+
+    double lambda = -demandaTotal;
+    for (int j : cobertura) {
+        lambda += capacidades[j];
+    }
+    double lado = 0.0;
+    double constante = 0.0;
+    for (int j : cobertura) {
+        double exceso = max(capacidades[j] - lambda, 0.0);
+        lado += flujo[j] + exceso * (1.0 - y[j]);
+        constante += exceso;
+    }
+    if (lado <= demandaTotal + 1e-6) {
+        return 0;
+    }
+
+    vector<int> idx;
+    vector<double> coef;
+    for (int j : cobertura) {
+        for (int i = 0; i < numClientes; ++i) {
+            idx.push_back(i*numFuentesProd + j);
+            coef.push_back(1.0);
+        }
+        double exceso = max(capacidades[j] - lambda, 0.0);
+        if (exceso > 0) {
+            idx.push_back(numVarX + j);
+            coef.push_back(-exceso);
+        }
+    }
+    pool.agregar(CORTE_COBERTURA_FLUJO, idx, coef, -COIN_DBL_MAX, demandaTotal - constante);
+    return 1;
+}
+
+/**
+ * Desc: Elige golosamente un conjunto de fuentes con capacidad total mayor al umbral,
+ *       tomando primero las de menor clave.
+ * Params:
+ *   - claves: Clave de cada fuente.
+ *   - umbral: Capacidad que el conjunto debe superar.
+ * Returns:
+ *   - vector<int>: Fuentes elegidas, o vacío si ni todas juntas superan el umbral.
+ */
+vector<int> SeparadorCortes::elegirCobertura(const vector<double>& claves, double umbral) {
+    orden.clear();
+    for (int j = 0; j < numFuentesProd; ++j) {
+        orden.emplace_back(claves[j], j);
+    }
+    sort(orden.begin(), orden.end());
+    vector<int> cobertura;
+    double peso = 0.0;
+    for (const auto& [clave, j] : orden) {
+        cobertura.push_back(j);
+        peso += capacidades[j];
+        if (peso > umbral + 1e-9) {
+            return cobertura;
+        }
+    }
+    return vector<int>();
+}
+
+/**
+ * Desc: Devuelve las rondas de separación hechas en la última raíz.
+ * Params: void
+ * Returns:
+ *   - int: Rondas que agregaron cortes.
+ */
+int SeparadorCortes::obtenerRondas() const { return rondas; }
+
+/**
+ * Desc: Devuelve la cota de la raíz antes de agregar cortes.
+ * Params: void
+ * Returns:
+ *   - double: Cota LP sin cortes.
+ */
+double SeparadorCortes::obtenerCotaInicial() const { return cotaInicial; }
+
+/**
+ * Desc: Devuelve la cota de la raíz tras la última ronda.
+ * Params: void
+ * Returns:
+ *   - double: Cota LP con cortes.
+ */
+double SeparadorCortes::obtenerCotaFinal() const { return cotaFinal; }
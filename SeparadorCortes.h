@@ -0,0 +1,50 @@
+#ifndef SEPARADOR_CORTES_H
+#define SEPARADOR_CORTES_H
+
+#include "Problema.h"
+#include "ModeloRelajacionLP.h"
+#include "PoolCortes.h"
+#include <vector>
+
+using namespace std;
+
+class SeparadorCortes {
+private:
+    int numClientes;
+    int numFuentesProd;
+    int numVarX;
+    double demandaTotal;
+    double capacidadTotal;
+    vector<double> demandas;
+    vector<double> capacidades;
+    int maxRondas;
+    double mejoraMinima;
+    int maxCortesRonda;
+
+    // Resultado de la última separación en la raíz
+    int rondas;
+    double cotaInicial;
+    double cotaFinal;
+
+    // Memoria de trabajo reutilizada entre rondas
+    vector<double> flujo;
+    vector<pair<double, int>> orden;
+
+    int separarCotaVariable(const double* x, const double* y, PoolCortes& pool);
+    int separarCobertura(const double* y, PoolCortes& pool);
+    int separarCoberturaFlujo(const double* x, const double* y, PoolCortes& pool);
+    vector<int> elegirCobertura(const vector<double>& claves, double umbral);
+
+public:
+    SeparadorCortes(int maxRondas = 20, double mejoraMinima = 1e-4, int maxCortesRonda = 500);
+
+    void construir(const Problema& problema);
+    int separar(const double* x, const double* y, PoolCortes& pool);
+    bool separarRaiz(ModeloRelajacionLP& modelo, PoolCortes& pool);
+
+    int obtenerRondas() const;
+    double obtenerCotaInicial() const;
+    double obtenerCotaFinal() const;
+};
+
+#endif // SEPARADOR_CORTES_H
@@ -0,0 +1,409 @@
+#include "StrategyBenders.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+
+static const double INFINITO = 1e20;
+static const double EPS_ENTERO = 1e-6;
+static const double TOL_VIOLACION = 1e-6;   // relativa a Q(y)
+static const int RONDAS_RAIZ = 200;
+static const int FRECUENCIA_REDONDEO = 20;  // nodos fraccionarios entre redondeos
+
+/**
+ * Desc: Constructor de la estrategia de descomposición de Benders.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - maxIter: Número máximo de nodos a ramificar.
+ *   - tol: Tolerancia para determinar la optimalidad.
+ * Returns: void
+ */
+StrategyBenders::StrategyBenders(const Problema& problema, int maxIter, double tol)
+    : maxIteraciones(maxIter), tolerancia(tol), maxRondasNodo(10), limiteTiempo(0.0),
+      numFuentesProd(problema.getNumFuentesProd()), cortesOptimalidad(0), cortesFactibilidad(0) {
+    maestro.setLogLevel(0);
+}
+
+/**
+ * Desc: Fija un límite de tiempo por resolución. Al alcanzarlo se devuelve la mejor
+ *       solución encontrada con TERMINO_LIMITE_TIEMPO.
+ * Params:
+ *   - segundos: Tiempo máximo; 0 o menos quita el límite.
+ * Returns: void
+ */
+void StrategyBenders::setLimiteTiempo(double segundos) { limiteTiempo = max(0.0, segundos); }
+
+/**
+ * Desc: Cambia cuántas rondas de cortes se separan en cada nodo fraccionario antes
+ *       de ramificar. En las soluciones enteras se separa siempre hasta que no haya
+ *       corte violado, que es lo que hace exacto al método.
+ * Params:
+ *   - rondas: Rondas por nodo (0 = solo cortes en la raíz y en soluciones enteras).
+ * Returns: void
+ */
+void StrategyBenders::setRondasNodo(int rondas) { maxRondasNodo = max(0, rondas); }
+
+/**
+ * Desc: Cortes de optimalidad agregados al maestro en la última resolución.
+ * Params: void
+ * Returns:
+ *   - int: Cantidad de cortes.
+ */
+int StrategyBenders::getCortesOptimalidad() const { return cortesOptimalidad; }
+
+/**
+ * Desc: Cortes de factibilidad agregados al maestro en la última resolución.
+ * Params: void
+ * Returns:
+ *   - int: Cantidad de cortes.
+ */
+int StrategyBenders::getCortesFactibilidad() const { return cortesFactibilidad; }
+
+/**
+ * Desc: Describe la configuración de la estrategia, para la caché de resultados.
+ * Params: void
+ * Returns:
+ *   - string: Parámetros en una línea, con los reales en su representación exacta.
+ */
+string StrategyBenders::getParametros() const {
+    ostringstream texto;
+    texto << setprecision(17) << getNombre() << " iter=" << maxIteraciones << " tol=" << tolerancia
+          << " rondas=" << maxRondasNodo << " tiempo=" << limiteTiempo;
+    return texto.str();
+}
+
+/**
+ * Desc: Carga el maestro inicial: columnas y_j en [0, 1] con costo f_j, la columna eta
+ *       con costo 1 acotada por el transporte más barato posible, y una sola fila de
+ *       capacidad agregada sum_j M_j y_j >= D. Todo lo demás entra como cortes.
+ * Params:
+ *   - problema: Referencia constante al problema.
+ * Returns: void
+ */
+void StrategyBenders::construirMaestro(const Problema& problema) {
+    int numColumnas = numFuentesProd + 1;
+    vector<CoinBigIndex> inicio(numColumnas + 1, 0);
+    vector<int> filas;
+    vector<double> valores;
+    vector<double> inferior(numColumnas, 0.0);
+    vector<double> superior(numColumnas, 1.0);
+    vector<double> objetivo(numColumnas, 1.0);
+    const vector<double>& capacidades = problema.getCapacidades();
+    for (int j = 0; j < numFuentesProd; j++) {
+        filas.push_back(0);
+        valores.push_back(capacidades[j]);
+        inicio[j + 1] = filas.size();
+        objetivo[j] = costosActivacion[j];
+    }
+    inicio[numColumnas] = filas.size();
+    inferior[numFuentesProd] = subproblema.getCotaTransporte();
+    superior[numFuentesProd] = COIN_DBL_MAX;
+
+    double demandaTotal = 0.0;
+    for (int i = 0; i < problema.getNumClientes(); i++) {
+        demandaTotal += problema.getDemanda(i);
+    }
+    double filaInferior = demandaTotal;
+    double filaSuperior = COIN_DBL_MAX;
+    maestro.loadProblem(numColumnas, 1, inicio.data(), filas.data(), valores.data(), inferior.data(),
+                        superior.data(), objetivo.data(), &filaInferior, &filaSuperior);
+}
+
+/**
+ * Desc: Agrega un corte al maestro como fila. Los cortes son globales: valen en todo
+ *       el árbol, así que quedan para el resto de la resolución.
+ * Params:
+ *   - nuevo: Corte de optimalidad (eta - sum_j a_j y_j >= b) o de factibilidad
+ *            (sum_j a_j y_j >= b).
+ * Returns: void
+ */
+void StrategyBenders::agregarCorte(const CorteBenders& nuevo) {
+    vector<int> indices;
+    vector<double> valores;
+    double signo = nuevo.optimalidad ? -1.0 : 1.0;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (nuevo.coeficientes[j] != 0.0) {
+            indices.push_back(j);
+            valores.push_back(signo * nuevo.coeficientes[j]);
+        }
+    }
+    if (nuevo.optimalidad) {
+        indices.push_back(numFuentesProd);
+        valores.push_back(1.0);
+        cortesOptimalidad++;
+    } else {
+        cortesFactibilidad++;
+    }
+    maestro.addRow(indices.size(), indices.data(), valores.data(), nuevo.constante, COIN_DBL_MAX);
+}
+
+/**
+ * Desc: Traslada las fijaciones del nodo a las cotas de las columnas y_j del maestro.
+ * Params:
+ *   - nodo: Nodo a acotar.
+ * Returns: void
+ */
+void StrategyBenders::aplicarFijaciones(const NodoCompacto* nodo) {
+    const uint64_t* cero = nodo->fijadasCero();
+    const uint64_t* uno = nodo->fijadasUno();
+    for (int j = 0; j < numFuentesProd; j++) {
+        uint64_t bit = uint64_t(1) << (j % 64);
+        double inferior = (uno[j / 64] & bit) ? 1.0 : 0.0;
+        double superior = (cero[j / 64] & bit) ? 0.0 : 1.0;
+        maestro.setColumnBounds(j, inferior, superior);
+    }
+}
+
+/**
+ * Desc: Costo exacto de una solución entera. El corte que genera se agrega al maestro,
+ *       porque es válido y exacto en ese punto.
+ * Params:
+ *   - solucion: Vector de activación de fuentes (0 o 1).
+ * Returns:
+ *   - double: Costos fijos más transporte óptimo, o 1e20 si no es factible.
+ */
+double StrategyBenders::evaluarSolucion(const vector<double>& solucion) {
+    double transporte = subproblema.resolver(solucion, corte);
+    agregarCorte(corte);
+    if (transporte >= INFINITO) {
+        return INFINITO;
+    }
+    double costo = transporte;
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (solucion[j] > 0.5) {
+            costo += costosActivacion[j];
+        }
+    }
+    return costo;
+}
+
+/**
+ * Desc: Acota un nodo con ramificación y cortes: resuelve el maestro con las fijaciones
+ *       del nodo y separa el subproblema en su solución, agregando cortes hasta que
+ *       ninguno quede violado o se acaben las rondas. Si el maestro da un y entero se
+ *       evalúa exactamente (y se informa como candidato a incumbente) y solo se cierra
+ *       el nodo cuando eta ya alcanza Q(y).
+ * Params:
+ *   - nodo: Nodo a acotar; recibe su cota y la variable de ramificación.
+ *   - maxRondas: Rondas de cortes si la solución es fraccionaria.
+ *   - cotaSup: Costo del incumbente, para podar.
+ *   - solucionY: Solución del maestro en y al terminar.
+ *   - solucionEntera: Mejor solución entera vista en el nodo.
+ *   - costoEntero: Su costo, o 1e20 si no hubo.
+ * Returns:
+ *   - bool: True si el nodo queda abierto (fraccionario y con cota menor que cotaSup).
+ */
+bool StrategyBenders::acotarNodo(NodoCompacto* nodo, int maxRondas, double cotaSup, vector<double>& solucionY,
+                                 vector<double>& solucionEntera, double& costoEntero) {
+    aplicarFijaciones(nodo);
+    costoEntero = INFINITO;
+    for (int ronda = 0;; ronda++) {
+        maestro.dual();
+        if (maestro.status() != 0) {
+            nodo->establecerCotaInferior(INFINITO);
+            return false;
+        }
+        double cota = maestro.objectiveValue();
+        nodo->establecerCotaInferior(cota);
+        nodo->estimacion = nodo->cotaInferior;
+        if (cota >= cotaSup - tolerancia) {
+            return false;
+        }
+
+        const double* columnas = maestro.primalColumnSolution();
+        solucionY.assign(columnas, columnas + numFuentesProd);
+        double eta = columnas[numFuentesProd];
+        bool entera = all_of(solucionY.begin(), solucionY.end(),
+                             [](double v) { return abs(v - round(v)) <= EPS_ENTERO; });
+        if (entera) {
+            for (double& v : solucionY) {
+                v = round(v);
+            }
+        }
+
+        double transporte = subproblema.resolver(solucionY, corte);
+        if (!corte.optimalidad) {
+            agregarCorte(corte);
+            continue;
+        }
+        bool violado = transporte - eta > TOL_VIOLACION * (1.0 + abs(transporte));
+        if (entera) {
+            double costo = transporte;
+            for (int j = 0; j < numFuentesProd; j++) {
+                costo += costosActivacion[j] * solucionY[j];
+            }
+            if (costo < costoEntero) {
+                costoEntero = costo;
+                solucionEntera = solucionY;
+            }
+            if (!violado) {
+                nodo->varRamificacion = -1;
+                return false;
+            }
+            agregarCorte(corte);
+            continue;
+        }
+        bool hayTiempo = limiteTiempo <= 0 || chrono::high_resolution_clock::now() < instanteLimite;
+        if (violado && ronda < maxRondas && hayTiempo) {
+            agregarCorte(corte);
+            continue;
+        }
+
+        // Ramificación en la variable más fraccionaria
+        int mejor = -1;
+        double mejorDistancia = -1.0;
+        for (int j = 0; j < numFuentesProd; j++) {
+            double distancia = min(solucionY[j] - floor(solucionY[j]), ceil(solucionY[j]) - solucionY[j]);
+            if (distancia > mejorDistancia) {
+                mejorDistancia = distancia;
+                mejor = j;
+            }
+        }
+        nodo->varRamificacion = mejor;
+        nodo->valorRamificacion = static_cast<float>(solucionY[mejor]);
+        return true;
+    }
+}
+
+/**
+ * Desc: Verifica los límites de nodos y de tiempo.
+ * Params:
+ *   - iteraciones: Nodos ramificados hasta ahora.
+ *   - motivo: Recibe el límite alcanzado.
+ * Returns:
+ *   - bool: True si hay que terminar.
+ */
+bool StrategyBenders::limiteAlcanzado(int iteraciones, MotivoTerminacion& motivo) const {
+    if (iteraciones >= maxIteraciones) {
+        motivo = TERMINO_LIMITE_ITERACIONES;
+        return true;
+    }
+    if (limiteTiempo > 0 && chrono::high_resolution_clock::now() >= instanteLimite) {
+        motivo = TERMINO_LIMITE_TIEMPO;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Desc: Resuelve el problema por descomposición de Benders. El incumbente inicial abre
+ *       todas las fuentes; la raíz separa hasta RONDAS_RAIZ rondas de cortes y el resto
+ *       de los nodos pocas, ramificando en la y más fraccionaria y explorando por mejor
+ *       cota. Cada cierto número de nodos se evalúa el redondeo hacia arriba de la
+ *       solución del maestro como heurística primal.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns:
+ *   - ResultadoSolucion: Mejor solución, cotas y motivo de terminación.
+ */
+ResultadoSolucion StrategyBenders::resolver(const Problema& problema) {
+    auto tiempoInicio = chrono::high_resolution_clock::now();
+    instanteLimite = tiempoInicio + chrono::duration_cast<chrono::high_resolution_clock::duration>(
+                                        chrono::duration<double>(limiteTiempo));
+    ResultadoSolucion resultado;
+    numFuentesProd = problema.getNumFuentesProd();
+    costosActivacion.assign(numFuentesProd, 0.0);
+    for (int j = 0; j < numFuentesProd; j++) {
+        costosActivacion[j] = problema.getCostoActivacion(j);
+    }
+    cortesOptimalidad = 0;
+    cortesFactibilidad = 0;
+    subproblema.construir(problema);
+    construirMaestro(problema);
+
+    // Incumbente inicial: todas las fuentes abiertas (su corte ya queda en el maestro)
+    vector<double> mejorSolucion(numFuentesProd, 1.0);
+    double mejorCotaSup = evaluarSolucion(mejorSolucion);
+    resultado.esFactible = mejorCotaSup < INFINITO;
+    cout << "Solución inicial (todas abiertas) - Costo: " << mejorCotaSup << "\n";
+
+    ArenaNodos arena(numFuentesProd);
+    PoolNodos pool(1, MEJOR_PRIMERO);
+    vector<double> solucionY;
+    vector<double> solucionEntera;
+    vector<double> redondeo(numFuentesProd);
+    double segundosNodos = 0.0;
+    int nodosFraccionarios = 0;
+
+    auto actualizarIncumbente = [&](const vector<double>& solucion, double costo) {
+        if (costo >= mejorCotaSup - tolerancia) {
+            return;
+        }
+        mejorCotaSup = costo;
+        mejorSolucion = solucion;
+        resultado.esFactible = true;
+        for (NodoCompacto* podado : pool.podar(mejorCotaSup - tolerancia)) {
+            arena.liberar(podado);
+        }
+    };
+    auto acotar = [&](NodoCompacto* nodo, int rondas) {
+        auto inicio = chrono::high_resolution_clock::now();
+        double costoEntero;
+        bool abierto = acotarNodo(nodo, rondas, mejorCotaSup, solucionY, solucionEntera, costoEntero);
+        if (costoEntero < INFINITO) {
+            actualizarIncumbente(solucionEntera, costoEntero);
+        }
+        if (abierto && nodosFraccionarios++ % FRECUENCIA_REDONDEO == 0) {
+            for (int j = 0; j < numFuentesProd; j++) {
+                redondeo[j] = solucionY[j] > EPS_ENTERO ? 1.0 : 0.0;
+            }
+            actualizarIncumbente(redondeo, evaluarSolucion(redondeo));
+        }
+        segundosNodos += chrono::duration<double>(chrono::high_resolution_clock::now() - inicio).count();
+        return abierto && nodo->cotaInferior < mejorCotaSup - tolerancia;
+    };
+
+    NodoCompacto* nodoRaiz = arena.crear();
+    bool raizAbierta = acotar(nodoRaiz, RONDAS_RAIZ);
+    resultado.cotaRaiz = min(static_cast<double>(nodoRaiz->cotaInferior), mejorCotaSup);
+    if (raizAbierta) {
+        pool.insertar(0, nodoRaiz);
+    } else {
+        arena.liberar(nodoRaiz);
+    }
+    cout << "Raíz - Cota: " << resultado.cotaRaiz << ", cortes: " << cortesOptimalidad << " de optimalidad y "
+         << cortesFactibilidad << " de factibilidad\n";
+
+    MotivoTerminacion motivo = TERMINO_OPTIMO;
+    while (!pool.vacio() && !limiteAlcanzado(resultado.numIteraciones, motivo)) {
+        resultado.numIteraciones++;
+        NodoCompacto* nodoActual = pool.extraer(0);
+        if (nodoActual->cotaInferior >= mejorCotaSup - tolerancia) {
+            arena.liberar(nodoActual);
+            continue;
+        }
+        for (int valor : {0, 1}) {
+            NodoCompacto* hijo = arena.crearHijo(nodoActual);
+            hijo->fijarVariable(nodoActual->varRamificacion, valor);
+            if (acotar(hijo, maxRondasNodo)) {
+                pool.insertar(0, hijo);
+            } else {
+                arena.liberar(hijo);
+            }
+        }
+        arena.liberar(nodoActual);
+        if (!pool.vacio() && mejorCotaSup - pool.mejorCotaInferior() <= tolerancia) {
+            break;
+        }
+    }
+
+    cout << "Cortes de Benders: " << cortesOptimalidad << " de optimalidad, " << cortesFactibilidad
+         << " de factibilidad\n";
+    if (resultado.esFactible) {
+        resultado.solucionFinal = mejorSolucion;
+        resultado.valorObjetivo = mejorCotaSup;
+    }
+    resultado.cotaInferior = pool.vacio() ? mejorCotaSup : min(mejorCotaSup, pool.mejorCotaInferior());
+    if (resultado.esFactible && resultado.valorObjetivo - resultado.cotaInferior <= tolerancia) {
+        motivo = TERMINO_OPTIMO;
+    } else if (!resultado.esFactible && resultado.cotaInferior >= INFINITO) {
+        motivo = TERMINO_INFACTIBLE;
+    }
+    resultado.motivoTerminacion = motivo;
+    resultado.actualizarBrecha();
+    resultado.tiempoRelajacion = segundosNodos;
+    resultado.tiempoEjecucion =
+        chrono::duration<double>(chrono::high_resolution_clock::now() - tiempoInicio).count();
+    return resultado;
+}
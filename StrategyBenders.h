@@ -0,0 +1,54 @@
+#ifndef STRATEGY_BENDERS_H
+#define STRATEGY_BENDERS_H
+
+#include "StrategyResolucion.h"
+#include "SubproblemaBenders.h"
+#include "ArenaNodos.h"
+#include "PoolNodos.h"
+#include <coin/ClpSimplex.hpp>
+#include <vector>
+#include <chrono>
+
+using namespace std;
+
+// Descomposición de Benders con ramificación y cortes: el maestro es un LP con solo
+// las aperturas y_j y la variable eta del costo de transporte; los cortes de
+// optimalidad y factibilidad salen de SubproblemaBenders y se agregan a medida que
+// las soluciones del maestro los violan, en cualquier nodo del árbol. El LP no crece
+// con n * m, así que escala a muchos clientes mejor que la relajación completa.
+class StrategyBenders : public StrategyResolucion {
+private:
+    int maxIteraciones;
+    double tolerancia;
+    int maxRondasNodo;           // rondas de cortes por nodo fraccionario; la raíz usa más
+    double limiteTiempo;         // segundos por resolución; 0 = sin límite
+    chrono::high_resolution_clock::time_point instanteLimite;
+    int numFuentesProd;
+    vector<double> costosActivacion;
+    SubproblemaBenders subproblema;
+    ClpSimplex maestro;
+    CorteBenders corte;
+    int cortesOptimalidad;
+    int cortesFactibilidad;
+
+    void construirMaestro(const Problema& problema);
+    void agregarCorte(const CorteBenders& nuevo);
+    void aplicarFijaciones(const NodoCompacto* nodo);
+    double evaluarSolucion(const vector<double>& solucion);
+    bool acotarNodo(NodoCompacto* nodo, int maxRondas, double cotaSup, vector<double>& solucionY,
+                    vector<double>& solucionEntera, double& costoEntero);
+    bool limiteAlcanzado(int iteraciones, MotivoTerminacion& motivo) const;
+
+public:
+    StrategyBenders(const Problema& problema, int maxIter, double tol);
+
+    ResultadoSolucion resolver(const Problema& problema) override;
+    string getNombre() const override { return "Descomposición de Benders"; }
+    string getParametros() const override;
+    void setLimiteTiempo(double segundos);
+    void setRondasNodo(int rondas);
+    int getCortesOptimalidad() const;
+    int getCortesFactibilidad() const;
+};
+
+#endif // STRATEGY_BENDERS_H
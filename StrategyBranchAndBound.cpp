@@ -1,4 +1,11 @@
 #include "StrategyBranchAndBound.h"
+#include "RamificacionFuerte.h"
+#include "RamificacionConfiabilidad.h"
+#include "HeuristicaRedondeo.h"
+#include "HeuristicaBuceo.h"
+#include "HeuristicaRINS.h"
+#include <sstream>
+#include <iomanip>
 
 /**
  * Desc: Constructor de la estrategia Branch and Bound.
@@ -7,118 +14,372 @@
  *   - problema: Referencia constante al problema a resolver.
  *   - maxIter: Número máximo de iteraciones permitidas.
  *   - tol: Tolerancia para determinar la optimalidad.
+ *   - pol: Política de selección de nodos abiertos.
+ *   - modo: Cota de cada nodo: relajación LP (Clp) o relajación Lagrangeana.
+ *   - rama: Regla para elegir la variable de ramificación (con la cota LP).
+ *   - cortes: Si se separan cortes en la raíz antes de ramificar (con la cota LP).
  * Returns: void
  */
-StrategyBranchAndBound::StrategyBranchAndBound(const Problema& problema, int maxIter, double tol) 
-    : maxIteraciones(maxIter), tolerancia(tol) {
+StrategyBranchAndBound::StrategyBranchAndBound(const Problema& problema, int maxIter, double tol, PoliticaSeleccion pol,
+                                               ModoAcotamiento modo, TipoRamificacion rama, bool cortes) 
+    : maxIteraciones(maxIter), tolerancia(tol), politica(pol), modoAcotamiento(modo), tipoRamificacion(rama), usarCortes(cortes),
+      frecuenciaBusquedaLocal(20), limiteTiempo(0.0), limiteMemoria(0),
+      intervaloProgreso(5.0), encabezadoProgreso(false), cotaRaiz(0.0), fijadasCostoReducidoRaiz(0), fijadasCostoReducidoNodo(0),
+      nanosegundosRelajacion(0), estadoVigente(false), reoptimizando(false), cambiaronDemandas(false),
+      cotaAnterior(-1e20), cotaHeredada(-1e20) {
+    switch (rama) {
+        case RAMA_FUERTE:
+            reglaRamificacion = make_unique<RamificacionFuerte>();
+            break;
+        case RAMA_PSEUDOCOSTO:
+            reglaRamificacion = make_unique<RamificacionPseudoCosto>();
+            break;
+        case RAMA_CONFIABILIDAD:
+            reglaRamificacion = make_unique<RamificacionConfiabilidad>();
+            break;
+        default:
+            reglaRamificacion = make_unique<ReglaRamificacion>();
+    }
+    cargarDatos(problema);
+    heuristicas.push_back(make_unique<HeuristicaRedondeo>());
+    heuristicas.push_back(make_unique<HeuristicaBuceo>());
+    heuristicas.push_back(make_unique<HeuristicaRINS>());
+}
+
+/**
+ * Desc: Copia del problema la demanda total y los costos de activación. Se llama
+ *       al construir y al empezar cada resolución, porque la estrategia puede recibir
+ *       otro problema que el del constructor (por ejemplo, el reducido).
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns: void
+ */
+void StrategyBranchAndBound::cargarDatos(const Problema& problema) {
     demandaTotal = 0.0;
     for (int i = 0; i < problema.getNumClientes(); i++) {
         demandaTotal += problema.getDemanda(i);
     }
+    costosActivacion.clear();
+    for (int j = 0; j < problema.getNumFuentesProd(); j++) {
+        costosActivacion.push_back(problema.getCostoActivacion(j));
+    }
+}
+
+/**
+ * Desc: Abre en la raíz las fuentes sin costo de activación: abrirlas nunca empeora
+ *       una solución (la reducción deja así a las fuentes obligadas).
+ * Params:
+ *   - nodoRaiz: Nodo raíz, aún sin acotar.
+ * Returns: void
+ */
+void StrategyBranchAndBound::fijarFuentesGratis(NodoCompacto* nodoRaiz) const {
+    for (int j = 0; j < (int)costosActivacion.size(); j++) {
+        if (costosActivacion[j] <= 0.0) {
+            nodoRaiz->fijarVariable(j, 1);
+        }
+    }
+}
+
+/**
+ * Desc: Deja lista la relajación persistente para el problema en curso. Normalmente
+ *       la construye y separa los cortes de la raíz. Al reoptimizar en modo LP, en
+ *       cambio, actualiza en su lugar el modelo anterior desde la base de la raíz:
+ *       los costos de activación no afectan la validez de los cortes; si cambiaron
+ *       demandas, se quitan los cortes y se vuelven a separar.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns: void
+ */
+void StrategyBranchAndBound::prepararRelajacion(const Problema& problema) {
+    bool reutilizar = reoptimizando && modoAcotamiento == COTA_LP && modeloLP.estaConstruido() &&
+                      baseRaiz.size() == modeloLP.tamanoBase();
+    {
+        MEDIR_FASE(instrumentacion, FASE_CONSTRUIR_RELAJACION);
+        // Se prepara siempre con la cota LP: los hilos del solver paralelo la leen después
+        if (modoAcotamiento == COTA_LP) {
+            estructuraLP.preparar(problema);
+        }
+        if (reutilizar) {
+            modeloLP.cargarBase(baseRaiz);
+            modeloLP.actualizarCostosActivacion(problema);
+            if (cambiaronDemandas) {
+                modeloLP.quitarCortes();
+                modeloLP.actualizarDemandas(problema);
+            }
+        } else if (modoAcotamiento == COTA_LP) {
+            modeloLP.construir(problema, estructuraLP);
+        } else {
+            lagrangeana.construir(problema);
+        }
+    }
+    if (modoAcotamiento == COTA_LP && (!reutilizar || cambiaronDemandas)) {
+        separarCortesRaiz(problema);
+    }
+}
+
+/**
+ * Desc: Al reoptimizar, evalúa en el problema nuevo la solución de la resolución
+ *       anterior y la toma como incumbente inicial si es mejor que la entregada.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - solucion: Incumbente inicial; se reemplaza si la anterior es mejor.
+ *   - costo: Costo del incumbente inicial; se actualiza junto con la solución.
+ * Returns: void
+ */
+void StrategyBranchAndBound::aprovecharSolucionAnterior(const Problema& problema, vector<double>& solucion,
+                                                        double& costo) {
+    if (!reoptimizando || solucionAnterior.size() != size_t(problema.getNumFuentesProd())) {
+        return;
+    }
+    double costoAnterior = calcularCostoExacto(problema, solucionAnterior);
+    cout << "Solución anterior - Costo: " << costoAnterior << "\n";
+    if (costoAnterior < costo) {
+        solucion = solucionAnterior;
+        costo = costoAnterior;
+    }
+}
+
+/**
+ * Desc: Guarda lo que una reoptimización posterior puede aprovechar: incumbente,
+ *       cota inferior global y los datos que el cambio puede tocar.
+ * Params:
+ *   - problema: Problema recién resuelto.
+ *   - resultado: Resultado de la resolución.
+ * Returns: void
+ */
+void StrategyBranchAndBound::guardarEstado(const Problema& problema, const ResultadoSolucion& resultado) {
+    solucionAnterior = resultado.esFactible ? resultado.solucionFinal : vector<double>();
+    cotaAnterior = resultado.cotaInferior;
+    demandasAnteriores = problema.getDemandas();
+    costosAnteriores = costosActivacion;
+    estadoVigente = true;
 }
 
 /**
  * Desc: Resuelve el problema utilizando Branch and Bound.
- *       Implementa la búsqueda en profundidad guiada por cotas inferiores y superiores.
+ *       Los nodos abiertos se guardan en un PoolNodos y se eligen según la política
+ *       de selección configurada (por defecto, menor cota inferior primero).
  * Params:
  *   - problema: Referencia constante al problema a resolver.
  * Returns:
  *   - ResultadoSolucion: Estructura que contiene la solución óptima encontrada,
  *                         incluyendo costo, tiempo de ejecución y factibilidad.
+ *                         Si se alcanza un límite, trae el incumbente, la cota
+ *                         inferior de los nodos abiertos y la brecha entre ambos.
  */
 ResultadoSolucion StrategyBranchAndBound::resolver(const Problema& problema) {
     auto tiempoInicio = chrono::high_resolution_clock::now();
     ResultadoSolucion resultado;
     resultado.numIteraciones = 0;
     resultado.esFactible = false;
+    iniciarReloj(tiempoInicio);
+    instrumentacion.reiniciar();
+    cargarDatos(problema);
+    costosReducidosRaiz.clear();
+    fijadasCostoReducidoRaiz = 0;
+    fijadasCostoReducidoNodo = 0;
+    nanosegundosRelajacion = 0;
 
-    priority_queue<shared_ptr<NodoArbol>, vector<shared_ptr<NodoArbol>>, ComparadorNodos> colaNodos;
+    // Grafo de transporte para evaluar soluciones enteras
+    evaluador.construir(problema);
     
     // Solución greedy inicial
     auto solGreedy = getSolucionGreedy(problema);
     double mejorCotaSup = calcularCostoExacto(problema, solGreedy);
     vector<double> mejorSolucion = solGreedy;
     cout << "Solución greedy inicial - Costo: " << mejorCotaSup << "\n";
+    aprovecharSolucionAnterior(problema, mejorSolucion, mejorCotaSup);
+    mejorarSolucionInicial(problema, mejorSolucion, mejorCotaSup);
+    resultado.esFactible = mejorCotaSup < 1e20;
+    int ultimaBusquedaLocal = 0;
+
+    // Relajación persistente: se construye una vez por resolución (o se actualiza al reoptimizar)
+    prepararRelajacion(problema);
+
+    // Al reoptimizar, el incumbente puede alcanzar ya la cota heredada de la resolución anterior
+    if (resultado.esFactible && mejorCotaSup <= cotaHeredada + tolerancia) {
+        cout << "Cota de la resolución anterior alcanzada - Costo: " << mejorCotaSup << "\n";
+        resultado.solucionFinal = mejorSolucion;
+        resultado.valorObjetivo = mejorCotaSup;
+        resultado.cotaRaiz = resultado.cotaInferior = min(mejorCotaSup, cotaHeredada);
+        completarResultado(resultado, TERMINO_OPTIMO);
+        guardarEstado(problema, resultado);
+        resultado.estadisticas = instrumentacion.obtenerEstadisticas();
+        resultado.tiempoEjecucion =
+            chrono::duration<double>(chrono::high_resolution_clock::now() - tiempoInicio).count();
+        return resultado;
+    }
+
+    // Memoria de los nodos: arena de nodos compactos y almacén de bases LP
+    // (o de multiplicadores, con la cota Lagrangeana)
+    ArenaNodos arena(problema.getNumFuentesProd());
+    AlmacenBases bases(tamanoEstadoNodo());
+    PoolNodos poolNodos(1, politica);
+    vector<double> solucionY;
+    vector<double> solucionHeuristica;
+    double costoHeuristica;
+    int nodosFraccionarios = 0;
 
     // Nodo raíz
-    auto nodoRaiz = make_shared<NodoArbol>();
-    resolverRelajacionLP(problema, nodoRaiz);
+    NodoCompacto* nodoRaiz = arena.crear();
+    CONTAR_INSTRUMENTACION(instrumentacion, contarCreado());
+    fijarFuentesGratis(nodoRaiz);
+    auto inicioRaiz = chrono::high_resolution_clock::now();
+    EstadoNodo estadoRaiz = acotarNodo(modeloLP, lagrangeana, bases, nodoRaiz, nullptr, mejorCotaSup, solucionY);
+    if (modoAcotamiento == COTA_LP) {
+        baseRaiz = modeloLP.obtenerBase();
+    }
+    if (modoAcotamiento == COTA_LAGRANGEANA && estadoRaiz != NODO_INFACTIBLE) {
+        auto finRaiz = chrono::high_resolution_clock::now();
+        compararCotaRaiz(problema, nodoRaiz->cotaInferior, chrono::duration<double>(finRaiz - inicioRaiz).count());
+    }
 
-    // cout << "[StrategyBranchAndBound::resolver] Raíz - Cota inferior: " << nodoRaiz->obtenerCotaInferior() << ", Factible: " << (nodoRaiz->obtenerFactibilidad() ? "Sí" : "No") << "\n";
+    // cout << "[StrategyBranchAndBound::resolver] Raíz - Cota inferior: " << nodoRaiz->cotaInferior << "\n";
 
-    if (!nodoRaiz->obtenerFactibilidad()) {
+    if (estadoRaiz == NODO_INFACTIBLE) {
         // cout << "[StrategyBranchAndBound::resolver] Nodo raíz inviable, terminando\n";
+        // La raíz también se descarta si su cota no baja del incumbente inicial
+        if (resultado.esFactible) {
+            resultado.solucionFinal = mejorSolucion;
+            resultado.valorObjetivo = mejorCotaSup;
+        }
+        resultado.cotaInferior = mejorCotaSup;
+        completarResultado(resultado, TERMINO_OPTIMO);
+        guardarEstado(problema, resultado);
+        resultado.estadisticas = instrumentacion.obtenerEstadisticas();
+        resultado.tiempoEjecucion =
+            chrono::duration<double>(chrono::high_resolution_clock::now() - tiempoInicio).count();
         return resultado;
     }
-    colaNodos.push(nodoRaiz);
-    double mejorCotaInf = nodoRaiz->obtenerCotaInferior();
+    double mejorCotaInf = nodoRaiz->cotaInferior;
+    resultado.cotaRaiz = nodoRaiz->cotaInferior;
+    if (estadoRaiz == NODO_ENTERO || estadoRaiz == NODO_CANDIDATO) {
+        double costoReal = calcularCostoExacto(problema, solucionY);
+        pulirSolucion(busquedaLocal, evaluador, solucionY, costoReal, mejorCotaSup, 0, ultimaBusquedaLocal);
+        if (costoReal <= mejorCotaSup + tolerancia) {
+            mejorCotaSup = costoReal;
+            mejorSolucion = solucionY;
+            resultado.esFactible = true;
+        }
+    }
+    if (estadoRaiz == NODO_FRACCIONARIO &&
+        ejecutarHeuristicas(problema, modeloLP, evaluador, nodoRaiz, solucionY, mejorSolucion, mejorCotaSup,
+                            nodosFraccionarios++, solucionHeuristica, costoHeuristica)) {
+        pulirSolucion(busquedaLocal, evaluador, solucionHeuristica, costoHeuristica, mejorCotaSup, 0, ultimaBusquedaLocal);
+        mejorCotaSup = costoHeuristica;
+        mejorSolucion = solucionHeuristica;
+        resultado.esFactible = true;
+    }
+    if (estadoRaiz != NODO_ENTERO && nodoRaiz->cotaInferior <= mejorCotaSup + tolerancia) {
+        poolNodos.insertar(0, nodoRaiz);
+    } else {
+        liberarNodo(arena, bases, nodoRaiz);
+    }
 
-    while (!colaNodos.empty() && resultado.numIteraciones < maxIteraciones) {
+    MotivoTerminacion motivo = TERMINO_OPTIMO;
+    while (!poolNodos.vacio() && !limiteAlcanzado(resultado.numIteraciones, arena, bases, motivo)) {
         resultado.numIteraciones++;
-        auto nodoActual = colaNodos.top();
-        colaNodos.pop();
+        NodoCompacto* nodoActual;
+        {
+            MEDIR_FASE(instrumentacion, FASE_COLA);
+            nodoActual = poolNodos.extraer(0);
+        }
     
         // Poda por cota
-        if (nodoActual->obtenerCotaInferior() >= mejorCotaSup + tolerancia) {
+        if (nodoActual->cotaInferior >= mejorCotaSup + tolerancia) {
+            CONTAR_INSTRUMENTACION(instrumentacion, contarPodadoPorCota());
+            liberarNodo(arena, bases, nodoActual);
             continue;
         }
     
-        // cout << "[StrategyBranchAndBound::resolver] Procesando nodo - Cota: " << nodoActual->obtenerCotaInferior() << "\n";
-    
-        // Verificar si es solución entera
-        if (nodoActual->esSolucionEntera()) {
-            double costoReal = calcularCostoExacto(problema, nodoActual->obtenerSolucion());
-            if (costoReal <= mejorCotaSup + tolerancia && costoReal >= 0) {
-                mejorCotaSup = costoReal;
-                mejorSolucion = nodoActual->obtenerSolucion();
-                resultado.esFactible = true;
-                // cout << "[StrategyBranchAndBound::resolver] Nueva mejor solución: " << mejorCotaSup << "\n";
-            }
-            continue;
-        }
+        // cout << "[StrategyBranchAndBound::resolver] Procesando nodo - Cota: " << nodoActual->cotaInferior << "\n";
     
-        // Ramificación
-        int varIdx = nodoActual->obtenerVarMasFraccionaria();
+        // Ramificación: la variable se eligió al resolver el LP del nodo
+        int varIdx = nodoActual->varRamificacion;
+        const unsigned char* basePadre = bases.obtener(nodoActual->idxBase);
         // cout << "[StrategyBranchAndBound::resolver] Ramificando en variable y" << varIdx << "\n";
     
-        // Crear hijos y resolver relajación LP
+        // Crear hijos y acotarlos partiendo de la base (o multiplicadores) del padre
         for (int valor : {0, 1}) {
-            auto nuevoNodo = make_shared<NodoArbol>(*nodoActual);
+            NodoCompacto* nuevoNodo = crearNodoHijo(arena, nodoActual);
             nuevoNodo->fijarVariable(varIdx, valor);
-            resolverRelajacionLP(problema, nuevoNodo);
+            EstadoNodo estado = acotarNodo(modeloLP, lagrangeana, bases, nuevoNodo, basePadre, mejorCotaSup, solucionY);
+            if (estado != NODO_INFACTIBLE) {
+                reglaRamificacion->registrarRama(varIdx, valor, nodoActual->valorRamificacion,
+                                                 nodoActual->cotaInferior, nuevoNodo->cotaInferior);
+            }
+
+            // Las soluciones enteras se evalúan (y se pulen) de inmediato; solo los candidatos siguen al pool
+            if (estado == NODO_ENTERO || estado == NODO_CANDIDATO) {
+                double costoReal = calcularCostoExacto(problema, solucionY);
+                pulirSolucion(busquedaLocal, evaluador, solucionY, costoReal, mejorCotaSup, resultado.numIteraciones,
+                              ultimaBusquedaLocal);
+                if (costoReal <= mejorCotaSup + tolerancia && costoReal >= 0) {
+                    mejorCotaSup = costoReal;
+                    mejorSolucion = solucionY;
+                    resultado.esFactible = true;
+                    podarNodos(poolNodos, arena, bases, mejorCotaSup);
+                    // cout << "[StrategyBranchAndBound::resolver] Nueva mejor solución: " << mejorCotaSup << "\n";
+                }
+            }
+
+            // Heurísticas primales a partir de la relajación del hijo
+            if (estado == NODO_FRACCIONARIO &&
+                ejecutarHeuristicas(problema, modeloLP, evaluador, nuevoNodo, solucionY, mejorSolucion, mejorCotaSup,
+                                    nodosFraccionarios++, solucionHeuristica, costoHeuristica)) {
+                pulirSolucion(busquedaLocal, evaluador, solucionHeuristica, costoHeuristica, mejorCotaSup,
+                              resultado.numIteraciones, ultimaBusquedaLocal);
+                mejorCotaSup = costoHeuristica;
+                mejorSolucion = solucionHeuristica;
+                resultado.esFactible = true;
+                podarNodos(poolNodos, arena, bases, mejorCotaSup);
+            }
     
-            if (nuevoNodo->obtenerFactibilidad() && 
-                nuevoNodo->obtenerCotaInferior() <= mejorCotaSup + tolerancia) {
-                colaNodos.push(nuevoNodo);
+            bool abierto = estado == NODO_FRACCIONARIO || estado == NODO_CANDIDATO;
+            if (abierto && nuevoNodo->cotaInferior <= mejorCotaSup + tolerancia) {
+                MEDIR_FASE(instrumentacion, FASE_COLA);
+                poolNodos.insertar(0, nuevoNodo);
+            } else {
+                if (abierto) {
+                    CONTAR_INSTRUMENTACION(instrumentacion, contarPodadoPorCota());
+                }
+                liberarNodo(arena, bases, nuevoNodo);
             }
         }
+        liberarNodo(arena, bases, nodoActual);
     
-        // Actualizar mejor cota inferior
-        if (!colaNodos.empty()) {
-            mejorCotaInf = colaNodos.top()->obtenerCotaInferior();
+        // Actualizar mejor cota inferior (fuera de mejor primero hay que recorrer el pool)
+        if (!poolNodos.vacio() && (politica == MEJOR_PRIMERO || resultado.numIteraciones % 100 == 0)) {
+            mejorCotaInf = poolNodos.mejorCotaInferior();
         }
     
-        // Verificar optimalidad al final
-        if (abs(mejorCotaSup - mejorCotaInf) <= tolerancia) {
-            // Procesar último nodo para confirmar
-            if (nodoActual->esSolucionEntera() && nodoActual->obtenerFactibilidad()) {
-                double costoReal = calcularCostoExacto(problema, nodoActual->obtenerSolucion());
-                if (costoReal <= mejorCotaSup + tolerancia) {
-                    mejorCotaSup = costoReal;
-                    mejorSolucion = nodoActual->obtenerSolucion();
-                    resultado.esFactible = true;
-                    // cout << "[StrategyBranchAndBound::resolver] Solución óptima confirmada - Costo: " << mejorCotaSup << "\n";
-                }
-            }
+        // Verificar optimalidad (con la cota heredada si se está reoptimizando)
+        if (abs(mejorCotaSup - mejorCotaInf) <= tolerancia || mejorCotaSup <= cotaHeredada + tolerancia) {
             break;
         }
+        if (progresoPendiente()) {
+            reportarProgreso(resultado.numIteraciones, poolNodos.tamano(), mejorCotaSup,
+                             poolNodos.vacio() ? mejorCotaSup : min(mejorCotaSup, poolNodos.mejorCotaInferior()));
+        }
     }
 
+    reportarHeuristicas();
+    reportarFijaciones();
+
     // Configurar resultado final
     if (resultado.esFactible) {
         resultado.solucionFinal = mejorSolucion;
         resultado.valorObjetivo = mejorCotaSup;
     }
+    resultado.cotaInferior = poolNodos.vacio() ? mejorCotaSup : min(mejorCotaSup, poolNodos.mejorCotaInferior());
+    resultado.cotaInferior = max(resultado.cotaInferior, min(mejorCotaSup, cotaHeredada));
+    completarResultado(resultado, motivo);
+    guardarEstado(problema, resultado);
+    resultado.estadisticas = instrumentacion.obtenerEstadisticas();
+#ifdef INSTRUMENTACION
+    resultado.estadisticas.imprimir();
+#endif
+    resultado.tiempoRelajacion = nanosegundosRelajacion * 1e-9;
     auto tiempoFin = chrono::high_resolution_clock::now();
     resultado.tiempoEjecucion = chrono::duration<double>(tiempoFin - tiempoInicio).count();
     // cout << "[StrategyBranchAndBound::resolver] Finalizando - Solución factible: " << (resultado.esFactible ? "Sí" : "No") << ", Costo: " << resultado.valorObjetivo << "\n";
@@ -126,126 +387,379 @@ ResultadoSolucion StrategyBranchAndBound::resolver(const Problema& problema) {
 }
 
 /**
- * Desc: Resuelve la relajación LP de un nodo dado usando simplex de COIN-OR.
- *       Calcula la cota inferior y verifica la factibilidad del nodo.
+ * Desc: Resuelve un problema que difiere del último resuelto en demandas o costos de
+ *       activación, partiendo de lo que dejó esa resolución: su solución como
+ *       incumbente inicial, la base LP de la raíz y, si las demandas no cambiaron,
+ *       los cortes y la cota inferior global. Con la misma región factible, esa cota
+ *       sigue valiendo rebajada en lo que bajaron los costos de activación, y basta
+ *       que el incumbente la alcance para terminar sin ramificar.
  * Params:
- *   - problema: Referencia constante al problema a resolver.
- *   - nodo: Puntero compartido al nodo actual.
- * Returns: void
+ *   - problema: Problema con el cambio ya aplicado.
+ *   - cambio: Cambio aplicado (solo para el registro; las diferencias se detectan
+ *             comparando con los datos guardados).
+ * Returns:
+ *   - ResultadoSolucion: Igual que resolver(). Sin resolución anterior de las mismas
+ *                         dimensiones, se resuelve desde cero.
  */
-void StrategyBranchAndBound::resolverRelajacionLP(const Problema& problema, shared_ptr<NodoArbol> nodo) {
-    const auto& fijadas = nodo->obtenerVariablesFijadas();
-    int numCli = problema.getNumClientes();
-    int numFue = problema.getNumFuentesProd();
-    
-    // Crear modelo de COIN-OR usando ClpSimplex
-    ClpSimplex modelo;
-    
-    // Número de variables: x_ij (transporte) + y_j (activación)
-    int numVarX = numCli * numFue;
-    int numVarY = numFue;
-    int totalVars = numVarX + numVarY;
-    
-    // Límites inferiores y superiores para variables
-    double* lower = new double[totalVars];
-    double* upper = new double[totalVars];
-    
-    // Variables x_ij (transporte): [0, inf)
-    for (int i = 0; i < numVarX; ++i) {
-        lower[i] = 0.0;
-        upper[i] = COIN_DBL_MAX;
+ResultadoSolucion StrategyBranchAndBound::reoptimizar(const Problema& problema, const CambioProblema& cambio) {
+    bool mismasDimensiones = costosAnteriores.size() == size_t(problema.getNumFuentesProd()) &&
+                             demandasAnteriores.size() == size_t(problema.getNumClientes());
+    if (!estadoVigente || !mismasDimensiones) {
+        return resolver(problema);
     }
-    // Variables y_j (activación): [0, 1] o fijadas si están en el nodo
-    for (int j = 0; j < numFue; ++j) {
-        int idx = numVarX + j;
-        auto it = fijadas.find(j);
-        if (it != fijadas.end()) {
-            lower[idx] = upper[idx] = it->second; // Fijada
-        } else {
-            lower[idx] = 0.0;
-            upper[idx] = 1.0; // LP relajado
+    cambiaronDemandas = demandasAnteriores != problema.getDemandas();
+    cotaHeredada = -1e20;
+    if (!cambiaronDemandas) {
+        cotaHeredada = cotaAnterior;
+        for (int j = 0; j < problema.getNumFuentesProd(); j++) {
+            cotaHeredada += min(0.0, problema.getCostoActivacion(j) - costosAnteriores[j]);
         }
     }
-    
-    // Función objetivo: min sum(f_j * y_j) + sum(c_ij * x_ij)
-    double* objCoeffs = new double[totalVars];
+    cout << "Reoptimizando tras cambiar " << cambio.demandas.size() << " demandas y "
+         << cambio.costosActivacion.size() << " costos de activación\n";
+
+    reoptimizando = true;
+    ResultadoSolucion resultado;
+    try {
+        resultado = resolver(problema);
+    } catch (...) {
+        reoptimizando = false;
+        cotaHeredada = -1e20;
+        throw;
+    }
+    reoptimizando = false;
+    cotaHeredada = -1e20;
+    return resultado;
+}
+
+/**
+ * Desc: Calcula la cota de un nodo con la relajación configurada.
+ * Params:
+ *   - modelo: Modelo LP persistente (modo COTA_LP).
+ *   - relajacion: Relajación Lagrangeana persistente (modo COTA_LAGRANGEANA).
+ *   - bases: Almacén donde se guarda la base o los multiplicadores del nodo.
+ *   - nodo: Nodo a evaluar.
+ *   - baseInicial: Base o multiplicadores del padre (nullptr para la raíz).
+ *   - cotaSup: Mejor solución conocida.
+ *   - solucionY: Salida con los valores y_j cuando la solución es entera.
+ * Returns:
+ *   - EstadoNodo: Estado del nodo tras acotarlo.
+ */
+EstadoNodo StrategyBranchAndBound::acotarNodo(ModeloRelajacionLP& modelo, RelajacionLagrangeana& relajacion, AlmacenBases& bases,
+                                              NodoCompacto* nodo, const unsigned char* baseInicial, double cotaSup,
+                                              vector<double>& solucionY) const {
+    MEDIR_FASE(instrumentacion, FASE_RELAJACION);
+    auto inicio = chrono::high_resolution_clock::now();
+    EstadoNodo estado = modoAcotamiento == COTA_LAGRANGEANA
+                            ? resolverRelajacionLagrangeana(relajacion, bases, nodo, baseInicial, cotaSup, solucionY)
+                            : resolverRelajacionLP(modelo, bases, nodo, baseInicial, cotaSup, solucionY);
+    auto fin = chrono::high_resolution_clock::now();
+    nanosegundosRelajacion += chrono::duration_cast<chrono::nanoseconds>(fin - inicio).count();
+    if (estado == NODO_INFACTIBLE) {
+        CONTAR_INSTRUMENTACION(instrumentacion, contarInfactible());
+    } else if (estado == NODO_ENTERO || estado == NODO_CANDIDATO) {
+        CONTAR_INSTRUMENTACION(instrumentacion, contarEntero());
+    }
+    return estado;
+}
+
+/**
+ * Desc: Resuelve la relajación LP de un nodo compacto usando simplex de COIN-OR.
+ *       Reutiliza el modelo persistente: solo cambian los límites de las y_j fijadas
+ *       y el simplex dual parte desde la base del padre.
+ *       Si la solución es fraccionaria, deja en el nodo su cota, su estimación,
+ *       su propia base y la variable elegida por la regla de ramificación
+ *       (para ramificarlo después).
+ *       Antes de resolver aplica la fijación por costo reducido de la raíz y después
+ *       la del propio nodo; las fijaciones quedan en el nodo y las heredan sus hijos.
+ * Params:
+ *   - modelo: Modelo LP persistente, ya construido para el problema.
+ *   - bases: Almacén donde se guarda la base del nodo.
+ *   - nodo: Nodo a evaluar.
+ *   - baseInicial: Base del padre (nullptr para la raíz).
+ *   - cotaSup: Costo del incumbente, para la fijación por costo reducido.
+ *   - solucionY: Salida con los valores y_j del nodo.
+ * Returns:
+ *   - EstadoNodo: NODO_INFACTIBLE, NODO_ENTERO o NODO_FRACCIONARIO.
+ */
+EstadoNodo StrategyBranchAndBound::resolverRelajacionLP(ModeloRelajacionLP& modelo, AlmacenBases& bases, NodoCompacto* nodo,
+                                                        const unsigned char* baseInicial, double cotaSup,
+                                                        vector<double>& solucionY) const {
+    if (!aplicarFijacionesRaiz(nodo, cotaSup)) {
+        return NODO_INFACTIBLE;
+    }
+    bool factible = modelo.resolver(*nodo, baseInicial);
+    CONTAR_INSTRUMENTACION(instrumentacion, registrarIteracionesLP(modelo.obtenerIteraciones()));
+    if (!factible) {
+        return NODO_INFACTIBLE;
+    }
+
+    double cotaInf = modelo.obtenerValorObjetivo();
+    nodo->establecerCotaInferior(cotaInf);
+
+    // Fijación por costo reducido: en la raíz se guarda su solución para repetirla con
+    // cada nueva cota superior; en los demás nodos vale para su subárbol
+    const double* costosReducidos = modelo.obtenerCostosReducidosY();
+    if (nodo->profundidad == 0) {
+        cotaRaiz = cotaInf;
+        valoresYRaiz.assign(modelo.obtenerValoresY(), modelo.obtenerValoresY() + costosActivacion.size());
+        costosReducidosRaiz.assign(costosReducidos, costosReducidos + costosActivacion.size());
+        fijadasCostoReducidoRaiz += fijarPorCostoReducido(valoresYRaiz.data(), costosReducidos, cotaInf, cotaSup, nodo);
+    } else {
+        fijadasCostoReducidoNodo += fijarPorCostoReducido(modelo.obtenerValoresY(), costosReducidos, cotaInf, cotaSup, nodo);
+    }
+
+    // Variable más fraccionaria y suma de fraccionalidades para la estimación
+    const double* valoresY = modelo.obtenerValoresY();
+    int numFue = costosActivacion.size();
+    int varMasFrac = -1;
+    double maxFraccion = 1e-6;
+    double sumaFraccionaria = 0.0;
     for (int j = 0; j < numFue; ++j) {
-        objCoeffs[numVarX + j] = problema.getCostoActivacion(j);
+        double fraccion = abs(valoresY[j] - round(valoresY[j]));
+        sumaFraccionaria += fraccion * costosActivacion[j];
+        if (fraccion > maxFraccion) {
+            maxFraccion = fraccion;
+            varMasFrac = j;
+        }
     }
-    for (int i = 0; i < numCli; ++i) {
-        for (int j = 0; j < numFue; ++j) {
-            objCoeffs[i*numFue + j] = problema.getCostoEnvio(i, j);
+
+    // Copia de las y_j: las pruebas de la regla de ramificación reescriben la solución del modelo
+    solucionY.assign(valoresY, valoresY + numFue);
+    if (varMasFrac == -1) {
+        return NODO_ENTERO;
+    }
+
+    nodo->estimacion = static_cast<float>(cotaInf + sumaFraccionaria);
+    nodo->idxBase = bases.guardar(modelo.obtenerEstadoBase());
+    nodo->varRamificacion = reglaRamificacion->elegirVariable(modelo, solucionY, bases.obtener(nodo->idxBase), cotaInf);
+    nodo->valorRamificacion = static_cast<float>(solucionY[nodo->varRamificacion]);
+    return NODO_FRACCIONARIO;
+}
+
+/**
+ * Desc: Fija en el nodo las y_j libres que están en una cota del LP y cuyo costo
+ *       reducido lleva la cota por sobre el incumbente si se las mueve a la otra:
+ *       en esa dirección no hay soluciones mejores, así que se fijan al valor actual.
+ * Params:
+ *   - valoresY: Valores y_j de la solución LP.
+ *   - costosReducidos: Costos reducidos de las y_j en esa solución.
+ *   - cota: Valor objetivo de esa solución.
+ *   - cotaSup: Costo del incumbente.
+ *   - nodo: Nodo donde se registran las fijaciones.
+ * Returns:
+ *   - int: Variables fijadas.
+ */
+int StrategyBranchAndBound::fijarPorCostoReducido(const double* valoresY, const double* costosReducidos, double cota,
+                                                  double cotaSup, NodoCompacto* nodo) const {
+    if (cotaSup >= 1e20) {
+        return 0;
+    }
+    int fijadas = 0;
+    for (int j = 0; j < (int)costosActivacion.size(); ++j) {
+        if (nodo->estaFijada(j)) {
+            continue;
+        }
+        if (valoresY[j] <= 1e-9 && cota + costosReducidos[j] > cotaSup + tolerancia) {
+            nodo->fijarVariable(j, 0);
+            fijadas++;
+        } else if (valoresY[j] >= 1.0 - 1e-9 && cota - costosReducidos[j] > cotaSup + tolerancia) {
+            nodo->fijarVariable(j, 1);
+            fijadas++;
         }
     }
-    
-    // Construir matriz de restricciones usando CoinPackedMatrix
-    CoinPackedMatrix matrix;
-    matrix.setDimensions(0, totalVars);
-    
-    // Restricciones de demanda: sum_j x_ij = d_i
-    for (int i = 0; i < numCli; ++i) {
-        CoinPackedVector fila;
-        for (int j = 0; j < numFue; ++j) {
-            fila.insert(i*numFue + j, 1.0);
+    return fijadas;
+}
+
+/**
+ * Desc: Repite en un nodo la fijación por costo reducido de la raíz con la cota
+ *       superior actual, que puede ser mejor que la que había al resolver la raíz.
+ *       Como la raíz es ancestro de todos, estas fijaciones valen en todo el árbol.
+ * Params:
+ *   - nodo: Nodo a punto de acotarse.
+ *   - cotaSup: Costo del incumbente.
+ * Returns:
+ *   - bool: False si el nodo ya fijó alguna de esas variables al otro valor, con lo
+ *           que ninguna solución de su subárbol mejora al incumbente.
+ */
+bool StrategyBranchAndBound::aplicarFijacionesRaiz(NodoCompacto* nodo, double cotaSup) const {
+    if (costosReducidosRaiz.empty() || nodo->profundidad == 0 || cotaSup >= 1e20) {
+        return true;
+    }
+    for (int j = 0; j < (int)costosReducidosRaiz.size(); ++j) {
+        int valor;
+        if (valoresYRaiz[j] <= 1e-9 && cotaRaiz + costosReducidosRaiz[j] > cotaSup + tolerancia) {
+            valor = 0;
+        } else if (valoresYRaiz[j] >= 1.0 - 1e-9 && cotaRaiz - costosReducidosRaiz[j] > cotaSup + tolerancia) {
+            valor = 1;
+        } else {
+            continue;
         }
-        matrix.appendRow(fila);
+        uint64_t bit = uint64_t(1) << (j % 64);
+        const uint64_t* opuesto = valor == 0 ? nodo->fijadasUno() : nodo->fijadasCero();
+        if (opuesto[j / 64] & bit) {
+            return false;
+        }
+        nodo->fijarVariable(j, valor);
     }
-    
-    // Restricciones de capacidad: sum_i x_ij - M_j * y_j <= 0
+    return true;
+}
+
+/**
+ * Desc: Imprime cuántas variables se fijaron por costo reducido en la resolución.
+ * Params: void
+ * Returns: void
+ */
+void StrategyBranchAndBound::reportarFijaciones() const {
+    if (modoAcotamiento == COTA_LP) {
+        cout << "Fijación por costo reducido: " << fijadasCostoReducidoRaiz << " en la raíz, "
+             << fijadasCostoReducidoNodo << " en nodos\n";
+    }
+}
+
+/**
+ * Desc: Acota un nodo con la relajación Lagrangeana de las restricciones de demanda.
+ *       Los multiplicadores del padre sirven de punto de partida y los del nodo se
+ *       guardan en el almacén, en el lugar que ocuparía su base LP.
+ *       Que las y_j Lagrangeanas sean enteras no cierra el nodo (la cota puede quedar
+ *       bajo el costo real): se devuelve NODO_CANDIDATO para evaluarlas y seguir
+ *       ramificando. Solo una hoja con todas las fuentes fijadas es NODO_ENTERO.
+ * Params:
+ *   - relajacion: Relajación Lagrangeana persistente, ya construida para el problema.
+ *   - bases: Almacén donde se guardan los multiplicadores del nodo.
+ *   - nodo: Nodo a evaluar.
+ *   - multiplicadores: Multiplicadores del padre (nullptr para la raíz).
+ *   - cotaSup: Mejor solución conocida, para el paso del subgradiente.
+ *   - solucionY: Salida con los valores y_j (redondeados cuando son enteros).
+ * Returns:
+ *   - EstadoNodo: NODO_INFACTIBLE, NODO_ENTERO, NODO_CANDIDATO o NODO_FRACCIONARIO.
+ */
+EstadoNodo StrategyBranchAndBound::resolverRelajacionLagrangeana(RelajacionLagrangeana& relajacion, AlmacenBases& bases,
+                                                                 NodoCompacto* nodo, const unsigned char* multiplicadores,
+                                                                 double cotaSup, vector<double>& solucionY) const {
+    if (!relajacion.resolver(*nodo, multiplicadores, cotaSup)) {
+        return NODO_INFACTIBLE;
+    }
+
+    double cotaInf = relajacion.obtenerValorObjetivo();
+    nodo->establecerCotaInferior(cotaInf);
+
+    const double* valoresY = relajacion.obtenerValoresY();
+    int numFue = costosActivacion.size();
+    bool entera = true;
+    double sumaFraccionaria = 0.0;
     for (int j = 0; j < numFue; ++j) {
-        CoinPackedVector fila;
-        for (int i = 0; i < numCli; ++i) {
-            fila.insert(i*numFue + j, 1.0);
+        double fraccion = abs(valoresY[j] - round(valoresY[j]));
+        sumaFraccionaria += fraccion * costosActivacion[j];
+        if (fraccion > 1e-6) {
+            entera = false;
         }
-        fila.insert(numVarX + j, -problema.getCapacidad(j)); // -M_j * y_j
-        matrix.appendRow(fila);
     }
-    
-    // Límites de las restricciones
-    double* rowLower = new double[numCli + numFue];
-    double* rowUpper = new double[numCli + numFue];
-    
-    for (int i = 0; i < numCli; ++i) {
-        rowLower[i] = rowUpper[i] = problema.getDemanda(i);
+
+    int var = relajacion.elegirVariable(*nodo);
+    if (var == -1) {
+        solucionY.assign(numFue, 0.0);
+        for (int j = 0; j < numFue; ++j) {
+            solucionY[j] = nodo->fijadasUno()[j / 64] & (uint64_t(1) << (j % 64)) ? 1.0 : 0.0;
+        }
+        return NODO_ENTERO;
     }
-    for (int j = 0; j < numFue; ++j) {
-        rowLower[numCli + j] = -COIN_DBL_MAX;
-        rowUpper[numCli + j] = 0.0;
+
+    nodo->varRamificacion = var;
+    nodo->valorRamificacion = static_cast<float>(valoresY[var]);
+    nodo->estimacion = static_cast<float>(cotaInf + sumaFraccionaria);
+    nodo->idxBase = bases.guardar(reinterpret_cast<const unsigned char*>(relajacion.obtenerMultiplicadores()));
+    solucionY.assign(valoresY, valoresY + numFue);
+    if (entera) {
+        for (double& v : solucionY) {
+            v = round(v);
+        }
+        return NODO_CANDIDATO;
     }
-    
-    modelo.loadProblem(matrix, lower, upper, objCoeffs, rowLower, rowUpper);
-    
-    // Configurar el modelo
-    modelo.dual();
-    
-    double cotaInf = modelo.objectiveValue();
-    const double* solucion = modelo.primalColumnSolution();
-    
-    // Verificar factibilidad (considerando tolerancia numérica)
-    bool factible = modelo.status() == 0;
-    vector<double> solucionY(numFue);
-    for (int j = 0; j < numFue; ++j) {
-        solucionY[j] = solucion[numVarX + j];
+    return NODO_FRACCIONARIO;
+}
+
+/**
+ * Desc: Fortalece la relajación LP de la raíz con cortes antes de ramificar.
+ *       Los cortes quedan como filas del modelo persistente, así que todos los nodos
+ *       los heredan, y en el pool, para cargarlos en los modelos de otros hilos.
+ *       Debe llamarse antes de crear el AlmacenBases: cambia el tamaño de la base.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns: void
+ */
+void StrategyBranchAndBound::separarCortesRaiz(const Problema& problema) {
+    MEDIR_FASE(instrumentacion, FASE_CORTES);
+    poolCortes.vaciar();
+    if (!usarCortes) {
+        return;
     }
-    
-    if (factible) {
-        nodo->establecerSolucion(solucionY);
-        nodo->establecerCotaInferior(cotaInf);
-        nodo->establecerFactibilidad(true);
-    } else {
-        nodo->establecerFactibilidad(false);
+    separador.construir(problema);
+    if (!separador.separarRaiz(modeloLP, poolCortes)) {
+        return;
     }
-    
-    delete[] lower;
-    delete[] upper;
-    delete[] objCoeffs;
-    delete[] rowLower;
-    delete[] rowUpper;
+    cout << "Cortes en la raíz: " << poolCortes.numCortes() << " (cota variable "
+         << poolCortes.contar(CORTE_COTA_VARIABLE) << ", cobertura " << poolCortes.contar(CORTE_COBERTURA)
+         << ", cobertura de flujo " << poolCortes.contar(CORTE_COBERTURA_FLUJO) << ") en "
+         << separador.obtenerRondas() << " rondas - Cota: " << separador.obtenerCotaInicial() << " -> "
+         << separador.obtenerCotaFinal() << "\n";
+}
+
+/**
+ * Desc: Devuelve cuántos bytes guarda cada nodo abierto para reanudar su relajación:
+ *       la base LP o los multiplicadores Lagrangeanos, según el modo.
+ * Params: void
+ * Returns:
+ *   - size_t: Bytes por nodo en el AlmacenBases.
+ */
+size_t StrategyBranchAndBound::tamanoEstadoNodo() const {
+    return modoAcotamiento == COTA_LP ? modeloLP.tamanoBase() : lagrangeana.tamanoMultiplicadores();
+}
+
+/**
+ * Desc: Resuelve también la relajación LP de la raíz e imprime ambas cotas, la brecha
+ *       entre ellas y el tiempo de cada una, para comparar los dos modos de acotamiento.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - cotaLagrangeana: Cota Lagrangeana obtenida en la raíz.
+ *   - segundosLagrangeana: Tiempo que tomó obtenerla.
+ * Returns: void
+ */
+void StrategyBranchAndBound::compararCotaRaiz(const Problema& problema, double cotaLagrangeana, double segundosLagrangeana) {
+    estructuraLP.preparar(problema);
+    modeloLP.construir(problema, estructuraLP);
+    auto inicio = chrono::high_resolution_clock::now();
+    if (!modeloLP.resolver(map<int, int>(), vector<unsigned char>())) {
+        return;
+    }
+    auto fin = chrono::high_resolution_clock::now();
+    double cotaLP = modeloLP.obtenerValorObjetivo();
+    double segundosLP = chrono::duration<double>(fin - inicio).count();
+    double brecha = abs(cotaLP) > 1e-9 ? 100.0 * (cotaLagrangeana - cotaLP) / abs(cotaLP) : 0.0;
+    cout << "Cota raíz Lagrangeana: " << cotaLagrangeana << " (" << segundosLagrangeana * 1000.0 << " ms, "
+         << lagrangeana.obtenerIteraciones() << " iteraciones)"
+         << " - Cota raíz LP: " << cotaLP << " (" << segundosLP * 1000.0 << " ms)"
+         << " - Brecha: " << brecha << "%\n";
+}
+
+/**
+ * Desc: Devuelve un nodo y su base a la arena y al almacén para reutilizar su memoria.
+ * Params:
+ *   - arena: Arena de la que se obtuvo el nodo.
+ *   - bases: Almacén donde está su base.
+ *   - nodo: Nodo a liberar.
+ * Returns: void
+ */
+void StrategyBranchAndBound::liberarNodo(ArenaNodos& arena, AlmacenBases& bases, NodoCompacto* nodo) const {
+    MEDIR_FASE(instrumentacion, FASE_NODOS);
+    bases.liberar(nodo->idxBase);
+    arena.liberar(nodo);
 }
 
 /**
  * Desc: Calcula el costo exacto de una solución entera dada.
- *       Verifica si la solución es factible y asigna clientes a fuentes de producción.
+ *       Para las fuentes abiertas resuelve el transporte óptimo como un flujo de
+ *       costo mínimo sobre el grafo del EvaluadorTransporte, que se arma una vez.
  * Params:
  *   - problema: Referencia constante al problema a resolver.
  *   - solucion: Vector de dobles representando la solución entera (activación de fuentes).
@@ -253,112 +767,346 @@ void StrategyBranchAndBound::resolverRelajacionLP(const Problema& problema, shar
  *   - double: Costo total de la solución (o 1e20 si no es factible).
  */
 double StrategyBranchAndBound::calcularCostoExacto(const Problema& problema, const vector<double>& solucion) {
+    MEDIR_FASE(instrumentacion, FASE_COSTO_EXACTO);
+    if (!evaluador.estaConstruido()) {
+        evaluador.construir(problema);
+    }
+    return evaluador.evaluar(solucion);
+}
 
-    // cout << "[StrategyBranchAndBound::calcularCostoExacto] Calculando costo exacto\n";
-    // cout << "[StrategyBranchAndBound::calcularCostoExacto] Solución: ";
-    // for (int j = 0; j < solucion.size(); j++) {
-    //     cout << "y" << j << "=" << solucion[j] << " ";
-    // }
-    // cout << endl;
-
-    double capacidadTotal = 0.0;
-    for (int j = 0; j < solucion.size(); j++) {
-        if (solucion[j] > 0.5) {
-            capacidadTotal += problema.getCapacidad(j);
-        }
+/**
+ * Desc: Aplica la búsqueda local a la solución inicial (la greedy), antes de la raíz.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - solucion: Solución inicial; al salir, la mejorada.
+ *   - costo: Su costo exacto; al salir, el de la mejorada.
+ * Returns:
+ *   - bool: True si la búsqueda local la mejoró.
+ */
+bool StrategyBranchAndBound::mejorarSolucionInicial(const Problema& problema, vector<double>& solucion, double& costo) {
+    busquedaLocal.construir(problema);
+    if (frecuenciaBusquedaLocal <= 0 || !busquedaLocal.mejorar(solucion, costo, evaluador)) {
+        return false;
     }
-    // cout << "[StrategyBranchAndBound::calcularCostoExacto] Capacidad total: " << capacidadTotal << ", Demanda total: " << demandaTotal << "\n";
-    
-    if (capacidadTotal < demandaTotal) {
-        // cout << "[StrategyBranchAndBound::calcularCostoExacto] Solución inviable - Capacidad insuficiente\n";
-        return 1e20;
+    cout << "Búsqueda local en la raíz - Costo: " << costo << " (" << busquedaLocal.obtenerMovimientosAceptados()
+         << " movimientos)\n";
+    return true;
+}
+
+/**
+ * Desc: Pule con búsqueda local una solución entera encontrada en el árbol.
+ *       Para no gastar tiempo en cada hoja, solo corre si la solución mejora al
+ *       incumbente o si pasaron frecuenciaBusquedaLocal nodos desde la última vez.
+ * Params:
+ *   - busqueda: Búsqueda local del hilo.
+ *   - evaluadorHilo: Evaluador de transporte del hilo.
+ *   - solucion: Solución entera; al salir, la pulida.
+ *   - costo: Su costo exacto; al salir, el de la pulida.
+ *   - cotaSup: Costo del incumbente actual.
+ *   - iteracion: Nodos procesados hasta ahora.
+ *   - ultimaIteracion: Nodo de la última búsqueda; se actualiza si corre.
+ * Returns: void
+ */
+void StrategyBranchAndBound::pulirSolucion(BusquedaLocal& busqueda, EvaluadorTransporte& evaluadorHilo, vector<double>& solucion,
+                                           double& costo, double cotaSup, int iteracion, int& ultimaIteracion) const {
+    if (frecuenciaBusquedaLocal <= 0 || costo >= 1e20) {
+        return;
     }
-    
-    vector<double> capRestante = problema.getCapacidades();
-    vector<double> demRestante = problema.getDemandas();  // Asumiendo que existe esta función
-    double costoTotal = 0.0;
-    
-    // Costos fijos
-    for (int j = 0; j < solucion.size(); j++) {
-        if (solucion[j] > 0.5) {
-            costoTotal += problema.getCostoActivacion(j);
+    if (costo < cotaSup - tolerancia || iteracion - ultimaIteracion >= frecuenciaBusquedaLocal) {
+        MEDIR_FASE(instrumentacion, FASE_BUSQUEDA_LOCAL);
+        ultimaIteracion = iteracion;
+        busqueda.mejorar(solucion, costo, evaluadorHilo);
+    }
+}
+
+/**
+ * Desc: Indica si alguna heurística primal corre en este nodo fraccionario, para no
+ *       preparar su entrada cuando no le toca a ninguna.
+ * Params:
+ *   - nodoFraccionario: Nodos fraccionarios vistos antes que este (0 en la raíz).
+ * Returns:
+ *   - bool: True si al menos una heurística debe ejecutarse.
+ */
+bool StrategyBranchAndBound::tocaHeuristica(int nodoFraccionario) const {
+    for (const auto& heuristica : heuristicas) {
+        if (heuristica->debeEjecutarse(nodoFraccionario) && (!heuristica->usaLP() || modoAcotamiento == COTA_LP)) {
+            return true;
         }
     }
-    
-    // Asignar clientes considerando eficiencia costo/demanda
-    vector<tuple<double, int>> clientesPorDensidad;
-    for (int i = 0; i < problema.getNumClientes(); i++) {
-        double mejorCosto = 1e20;
-        for (int j = 0; j < problema.getNumFuentesProd(); j++) {
-            if (solucion[j] > 0.5) {
-                mejorCosto = min(mejorCosto, problema.getCostoEnvio(i, j));
-            }
+    return false;
+}
+
+/**
+ * Desc: Corre sobre un nodo fraccionario las heurísticas primales que le tocan.
+ *       Con la cota Lagrangeana solo corren las que no resuelven LPs. Las que usan
+ *       el modelo lo dejan con otros límites, pero el próximo nodo carga los suyos.
+ *       Cada mejora pasa a ser la cota contra la que se comparan las siguientes.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - modelo: Modelo LP del hilo, con la solución del nodo.
+ *   - evaluadorHilo: Evaluador de transporte del hilo.
+ *   - nodo: Nodo recién acotado.
+ *   - solucionY: Valores y_j de su relajación.
+ *   - incumbente: Mejor solución conocida (vacía si no hay).
+ *   - cotaSup: Su costo.
+ *   - nodoFraccionario: Nodos fraccionarios vistos antes que este (0 en la raíz).
+ *   - solucion: Salida con la mejor solución encontrada.
+ *   - costo: Salida con su costo exacto.
+ * Returns:
+ *   - bool: True si alguna heurística mejoró a cotaSup.
+ */
+bool StrategyBranchAndBound::ejecutarHeuristicas(const Problema& problema, ModeloRelajacionLP& modelo,
+                                                 EvaluadorTransporte& evaluadorHilo, const NodoCompacto* nodo,
+                                                 const vector<double>& solucionY, const vector<double>& incumbente,
+                                                 double cotaSup, int nodoFraccionario, vector<double>& solucion,
+                                                 double& costo) const {
+    MEDIR_FASE(instrumentacion, FASE_HEURISTICAS);
+    ContextoHeuristica contexto{&problema, modoAcotamiento == COTA_LP ? &modelo : nullptr, &evaluadorHilo, nodo,
+                                &solucionY, &incumbente, cotaSup, tolerancia, {}};
+    bool mejoro = false;
+    vector<double> encontrada;
+    double costoEncontrada;
+    for (const auto& heuristica : heuristicas) {
+        if (!heuristica->debeEjecutarse(nodoFraccionario) || (heuristica->usaLP() && contexto.modelo == nullptr)) {
+            continue;
         }
-        if (mejorCosto < 1e20) {
-            double densidad = mejorCosto / demRestante[i];
-            clientesPorDensidad.emplace_back(densidad, i);
+        if (heuristica->ejecutar(contexto, encontrada, costoEncontrada)) {
+            solucion = encontrada;
+            costo = costoEncontrada;
+            contexto.cotaSup = costo;
+            contexto.incumbente = &solucion;
+            mejoro = true;
         }
     }
-    
-    sort(clientesPorDensidad.begin(), clientesPorDensidad.end());
-    
-    for (const auto& [densidad, idxCliente] : clientesPorDensidad) {
-        int cliente = idxCliente;
-        double dem = demRestante[cliente];
-        double mejorCosto = 1e20;
-        int mejorFacilidad = -1;
-        
-        vector<tuple<double, int, double>> fuentesPorEficiencia;
-        for (int j = 0; j < problema.getNumFuentesProd(); j++) {
-            if (solucion[j] > 0.5 && capRestante[j] > 1e-6) {
-                double costo = problema.getCostoEnvio(cliente, j);
-                double eficiencia = costo / capRestante[j];
-                fuentesPorEficiencia.emplace_back(costo, j, eficiencia);
-            }
-        }
-        
-        // en el principio, solo Dios y yo sabíamos lo que hacía el código. ahora, solo Dios lo sabe
-        sort(fuentesPorEficiencia.begin(), fuentesPorEficiencia.end(), [](const auto& a, const auto& b) { return get<2>(a) < get<2>(b);});
-        
-        if (!fuentesPorEficiencia.empty()) {
-            mejorFacilidad = get<1>(fuentesPorEficiencia[0]);
-            mejorCosto = get<0>(fuentesPorEficiencia[0]);
+    return mejoro;
+}
+
+/**
+ * Desc: Imprime las estadísticas de cada heurística primal usada en la resolución.
+ * Params: void
+ * Returns: void
+ */
+void StrategyBranchAndBound::reportarHeuristicas() const {
+    for (const auto& heuristica : heuristicas) {
+        if (heuristica->obtenerLlamadas() == 0) {
+            continue;
         }
-        
-        if (mejorFacilidad == -1) {
-            return 1e20;
+        cout << "Heurística " << heuristica->getNombre() << ": " << heuristica->obtenerLlamadas() << " llamadas, "
+             << heuristica->obtenerExitos() << " factibles, " << heuristica->obtenerMejoras() << " mejoras ("
+             << heuristica->obtenerSegundos() * 1000.0 << " ms)\n";
+    }
+}
+
+/**
+ * Desc: Da acceso a las heurísticas primales, para cambiar su frecuencia o su
+ *       presupuesto de tiempo y leer sus estadísticas.
+ * Params: void
+ * Returns:
+ *   - const vector<unique_ptr<HeuristicaPrimal>>&: Redondeo, buceo y RINS, en ese orden.
+ */
+const vector<unique_ptr<HeuristicaPrimal>>& StrategyBranchAndBound::getHeuristicas() const { return heuristicas; }
+
+/**
+ * Desc: Describe la configuración de la estrategia: nombre, límites, tolerancia,
+ *       selección, cota, ramificación, cortes, búsqueda local y heurísticas.
+ *       Dos estrategias con el mismo texto resuelven igual el mismo problema.
+ * Params: void
+ * Returns:
+ *   - string: Parámetros en una línea, con los reales en su representación exacta.
+ */
+string StrategyBranchAndBound::getParametros() const {
+    ostringstream texto;
+    texto << setprecision(17) << getNombre() << " iter=" << maxIteraciones << " tol=" << tolerancia
+          << " politica=" << politica << " cota=" << modoAcotamiento << " rama=" << tipoRamificacion
+          << " cortes=" << usarCortes << " busqueda=" << frecuenciaBusquedaLocal << " tiempo=" << limiteTiempo
+          << " memoria=" << limiteMemoria;
+    for (const auto& heuristica : heuristicas) {
+        texto << " " << heuristica->getNombre() << "=" << heuristica->getFrecuencia() << "/"
+              << heuristica->getPresupuesto();
+    }
+    return texto.str();
+}
+
+/**
+ * Desc: Cambia cada cuántos nodos se pulen con búsqueda local las soluciones enteras
+ *       que no mejoran al incumbente (las que lo mejoran se pulen siempre).
+ * Params:
+ *   - nodos: Nodos entre búsquedas; 0 o menos desactiva la búsqueda local.
+ * Returns: void
+ */
+void StrategyBranchAndBound::setFrecuenciaBusquedaLocal(int nodos) { frecuenciaBusquedaLocal = nodos; }
+
+/**
+ * Desc: Fija un límite de tiempo por resolución. Al alcanzarlo se deja de ramificar
+ *       y se devuelve el incumbente con la cota de los nodos que quedaron abiertos.
+ *       Se revisa antes de cada nodo, así que puede excederse en lo que tarde uno.
+ * Params:
+ *   - segundos: Tiempo máximo; 0 o menos quita el límite.
+ * Returns: void
+ */
+void StrategyBranchAndBound::setLimiteTiempo(double segundos) { limiteTiempo = max(0.0, segundos); }
+
+/**
+ * Desc: Calcula el instante en que vence el límite de tiempo de esta resolución y el
+ *       de la primera línea de progreso.
+ * Params:
+ *   - inicio: Instante de inicio de la resolución.
+ * Returns: void
+ */
+void StrategyBranchAndBound::iniciarReloj(chrono::high_resolution_clock::time_point inicio) {
+    inicioResolucion = inicio;
+    encabezadoProgreso = false;
+    proximoProgreso = inicio + chrono::duration_cast<chrono::high_resolution_clock::duration>(
+                                   chrono::duration<double>(intervaloProgreso));
+    instanteLimite = inicio + chrono::duration_cast<chrono::high_resolution_clock::duration>(
+                                  chrono::duration<double>(limiteTiempo));
+}
+
+/**
+ * Desc: Fija un límite a la memoria de los nodos abiertos (nodos compactos y sus
+ *       bases o multiplicadores). Al alcanzarlo se termina como con el de tiempo.
+ * Params:
+ *   - megabytes: Memoria máxima; 0 o menos quita el límite.
+ * Returns: void
+ */
+void StrategyBranchAndBound::setLimiteMemoria(double megabytes) {
+    limiteMemoria = megabytes > 0 ? size_t(megabytes * 1024 * 1024) : 0;
+}
+
+/**
+ * Desc: Cambia cada cuántos segundos se imprime una línea de progreso.
+ * Params:
+ *   - segundos: Intervalo; 0 o menos desactiva el registro.
+ * Returns: void
+ */
+void StrategyBranchAndBound::setIntervaloProgreso(double segundos) { intervaloProgreso = max(0.0, segundos); }
+
+/**
+ * Desc: Indica si ya toca imprimir una línea de progreso.
+ * Params: void
+ * Returns:
+ *   - bool: True si el registro está activo y venció el intervalo.
+ */
+bool StrategyBranchAndBound::progresoPendiente() const {
+    return intervaloProgreso > 0 && chrono::high_resolution_clock::now() >= proximoProgreso;
+}
+
+/**
+ * Desc: Imprime una línea de progreso con nodos procesados, nodos abiertos, incumbente,
+ *       cota inferior global, brecha y tiempo, con un encabezado la primera vez.
+ * Params:
+ *   - nodos: Nodos procesados.
+ *   - abiertos: Nodos en el pool.
+ *   - cotaSup: Costo del incumbente (1e20 si no hay).
+ *   - cotaInf: Cota inferior global.
+ * Returns: void
+ */
+void StrategyBranchAndBound::reportarProgreso(int nodos, size_t abiertos, double cotaSup, double cotaInf) const {
+    auto ahora = chrono::high_resolution_clock::now();
+    proximoProgreso = ahora + chrono::duration_cast<chrono::high_resolution_clock::duration>(
+                                  chrono::duration<double>(intervaloProgreso));
+    ostringstream linea;
+    if (!encabezadoProgreso) {
+        linea << setw(10) << "Nodos" << setw(10) << "Abiertos" << setw(16) << "Incumbente" << setw(16) << "Cota inf."
+              << setw(9) << "Brecha" << setw(9) << "Tiempo" << "\n";
+        encabezadoProgreso = true;
+    }
+    linea << fixed << setprecision(2) << setw(10) << nodos << setw(10) << abiertos;
+    if (cotaSup < 1e20) {
+        linea << setw(16) << cotaSup << setw(16) << cotaInf << setw(8)
+              << 100 * max(0.0, cotaSup - cotaInf) / (1e-10 + abs(cotaSup)) << "%";
+    } else {
+        linea << setw(16) << "-" << setw(16) << cotaInf << setw(9) << "-";
+    }
+    linea << setw(8) << setprecision(1) << chrono::duration<double>(ahora - inicioResolucion).count() << "s\n";
+    cout << linea.str() << flush;
+}
+
+/**
+ * Desc: Revisa los límites de la resolución en curso antes de procesar un nodo.
+ * Params:
+ *   - iteraciones: Nodos procesados hasta ahora.
+ *   - arena: Arena de los nodos abiertos.
+ *   - bases: Almacén de sus bases o multiplicadores.
+ *   - motivo: Salida con el límite alcanzado.
+ * Returns:
+ *   - bool: True si se alcanzó algún límite.
+ */
+bool StrategyBranchAndBound::limiteAlcanzado(int iteraciones, const ArenaNodos& arena, const AlmacenBases& bases,
+                                             MotivoTerminacion& motivo) const {
+    if (iteraciones >= maxIteraciones) {
+        motivo = TERMINO_LIMITE_ITERACIONES;
+        return true;
+    }
+    if (limiteTiempo > 0 && chrono::high_resolution_clock::now() >= instanteLimite) {
+        motivo = TERMINO_LIMITE_TIEMPO;
+        return true;
+    }
+    if (limiteMemoria > 0) {
+        size_t bytes = arena.nodosVivos() * (arena.bytesPorNodo() + sizeof(NodoCompacto*)) +
+                       bases.basesVivas() * bases.obtenerTamanoBase();
+        if (bytes >= limiteMemoria) {
+            motivo = TERMINO_LIMITE_MEMORIA;
+            return true;
         }
-        
-        costoTotal += mejorCosto * dem;
-        capRestante[mejorFacilidad] -= dem;
     }
+    return false;
+}
 
-    // cout << "[StrategyBranchAndBound::calcularCostoExacto] Solución factible - Costo total: " << costoTotal << "\n";
-    
-    return costoTotal;
+/**
+ * Desc: Completa el motivo de terminación y la brecha, una vez fijados la solución
+ *       y la cota inferior global. Si la brecha quedó dentro de la tolerancia, el
+ *       resultado es óptimo aunque se haya alcanzado un límite.
+ * Params:
+ *   - resultado: Resultado a completar.
+ *   - motivo: Motivo por el que terminó la búsqueda.
+ * Returns: void
+ */
+void StrategyBranchAndBound::completarResultado(ResultadoSolucion& resultado, MotivoTerminacion motivo) const {
+    if (resultado.esFactible && resultado.valorObjetivo - resultado.cotaInferior <= tolerancia) {
+        motivo = TERMINO_OPTIMO;
+    } else if (!resultado.esFactible && resultado.cotaInferior >= 1e20) {
+        motivo = TERMINO_INFACTIBLE;
+    }
+    resultado.motivoTerminacion = motivo;
+    resultado.actualizarBrecha();
 }
 
 /**
  * Desc: Filtra nodos cuya cota inferior es peor que la cota superior actual.
- *       Reduce el tamaño del árbol de búsqueda eliminando ramas inviables.
+ *       Reduce el tamaño del árbol de búsqueda eliminando ramas inviables
+ *       y devuelve su memoria a la arena.
  * Params:
+ *   - pool: Pool de nodos abiertos a filtrar.
+ *   - arena: Arena de nodos.
+ *   - bases: Almacén de bases LP.
  *   - mejorCotaSup: Cota superior actual (mejor solución encontrada hasta ahora).
  * Returns: void
  */
-void StrategyBranchAndBound::podarNodos(double mejorCotaSup) {
-
-    priority_queue<shared_ptr<NodoArbol>, vector<shared_ptr<NodoArbol>>, ComparadorNodos> nuevaCola;
-    while (!colaNodos.empty()) {
-        auto nodo = colaNodos.top();
-        colaNodos.pop();
-        if (nodo->obtenerCotaInferior() <= mejorCotaSup + tolerancia) {
-            nuevaCola.push(nodo);
-            // cout << "[StrategyBranchAndBound::resolver] Nodo hijo añadido - Cota: " << nodo->obtenerCotaInferior() << "\n";
-        }//else{
-        //     cout << "[StrategyBranchAndBound::resolver] Nodo hijo rechazado - Cota: " << nodo->obtenerCotaInferior() << "\n";
-        // }
+void StrategyBranchAndBound::podarNodos(PoolNodos& pool, ArenaNodos& arena, AlmacenBases& bases, double mejorCotaSup) const {
+    vector<NodoCompacto*> podados;
+    {
+        MEDIR_FASE(instrumentacion, FASE_COLA);
+        podados = pool.podar(mejorCotaSup + tolerancia);
     }
-    colaNodos = move(nuevaCola);
+    CONTAR_INSTRUMENTACION(instrumentacion, contarPodadoPorCota(podados.size()));
+    for (NodoCompacto* nodo : podados) {
+        liberarNodo(arena, bases, nodo);
+    }
+}
+
+/**
+ * Desc: Crea un hijo de un nodo en la arena (copia sus fijaciones).
+ * Params:
+ *   - arena: Arena de nodos.
+ *   - padre: Nodo a ramificar.
+ * Returns:
+ *   - NodoCompacto*: Hijo con las mismas fijaciones que el padre.
+ */
+NodoCompacto* StrategyBranchAndBound::crearNodoHijo(ArenaNodos& arena, const NodoCompacto* padre) const {
+    MEDIR_FASE(instrumentacion, FASE_NODOS);
+    CONTAR_INSTRUMENTACION(instrumentacion, contarCreado());
+    return arena.crearHijo(padre);
 }
 
 /**
@@ -381,7 +1129,7 @@ bool StrategyBranchAndBound::esOptimo(double cotaInf, double cotaSup) const {
  * Returns:
  *   - vector<double>: Solución greedy (activación de fuentes).
  */
-vector<double> StrategyBranchAndBound::getSolucionGreedy(const Problema& problema) {
+vector<double> StrategyBranchAndBound::getSolucionGreedy(const Problema& problema) const {
     int numFuentesProd = problema.getNumFuentesProd();
     int numClientes = problema.getNumClientes();
     vector<int> solucion(numFuentesProd, 0);
@@ -397,10 +1145,11 @@ vector<double> StrategyBranchAndBound::getSolucionGreedy(const Problema& problem
         double transporteOptimizado = 0.0;
         double capDisponible = cap;
         
-        // Calcular costo de transporte optimizado por cliente
+        // Calcular costo de transporte optimizado por cliente (columna contigua de la fuente)
+        VistaCostos costosFuente = problema.getCostosFuente(j);
         vector<tuple<double, double, int>> clientesPorDensidad;
         for (int i = 0; i < numClientes; ++i) {
-            double costo = problema.getCostoEnvio(i, j);
+            double costo = costosFuente[i];
             double dem = problema.getDemanda(i);
             double densidad = costo / dem;
             clientesPorDensidad.emplace_back(densidad, dem, i);
@@ -410,7 +1159,7 @@ vector<double> StrategyBranchAndBound::getSolucionGreedy(const Problema& problem
         // Asignar clientes por orden de eficiencia
         for (const auto& [densidad, dem, idx] : clientesPorDensidad) {
             if (dem <= capDisponible) {
-                transporteOptimizado += dem * problema.getCostoEnvio(idx, j);
+                transporteOptimizado += dem * costosFuente[idx];
                 capDisponible -= dem;
             }
         }
@@ -3,38 +3,143 @@
 
 #include "StrategyResolucion.h"
 #include "ComparadorNodos.h"
-#include <coin/ClpSimplex.hpp>          
-#include <coin/CoinPackedMatrix.hpp>
-#include <coin/CoinPackedVector.hpp> 
-#include <queue>
+#include "PoolNodos.h"
+#include "ArenaNodos.h"
+#include "AlmacenBases.h"
+#include "ModeloRelajacionLP.h"
+#include "RelajacionLagrangeana.h"
+#include "SeparadorCortes.h"
+#include "PoolCortes.h"
+#include "ReglaRamificacion.h"
+#include "EvaluadorTransporte.h"
+#include "BusquedaLocal.h"
+#include "HeuristicaPrimal.h"
+#include "Instrumentacion.h"
 #include <vector>
 #include <iostream>
 #include <chrono>
 #include <algorithm>
 #include <cmath>
 #include <cfloat>
+#include <atomic>
 
 using namespace std;
 
+enum EstadoNodo {
+    NODO_INFACTIBLE,
+    NODO_ENTERO,
+    NODO_CANDIDATO,
+    NODO_FRACCIONARIO
+};
+
+enum ModoAcotamiento {
+    COTA_LP,
+    COTA_LAGRANGEANA
+};
+
 class StrategyBranchAndBound : public StrategyResolucion {
-private:
+protected:
     int maxIteraciones;
     double tolerancia;
     double demandaTotal;
+    vector<double> costosActivacion;
+    PoliticaSeleccion politica;
+    ModoAcotamiento modoAcotamiento;
+    TipoRamificacion tipoRamificacion;
+    bool usarCortes;
+    int frecuenciaBusquedaLocal;
+    double limiteTiempo;         // segundos por resolución; 0 = sin límite
+    size_t limiteMemoria;        // bytes de nodos abiertos (nodos y bases); 0 = sin límite
+    chrono::high_resolution_clock::time_point instanteLimite;
+    chrono::high_resolution_clock::time_point inicioResolucion;
+    double intervaloProgreso;    // segundos entre líneas de progreso; 0 = sin registro
+    mutable chrono::high_resolution_clock::time_point proximoProgreso;
+    mutable bool encabezadoProgreso;
+    mutable Instrumentacion instrumentacion;
+    unique_ptr<ReglaRamificacion> reglaRamificacion;
+    EstructuraLP estructuraLP;      // matriz CSC de la relajación, compartida por los modelos de los hilos
+    ModeloRelajacionLP modeloLP;
+    RelajacionLagrangeana lagrangeana;
+    EvaluadorTransporte evaluador;
+    SeparadorCortes separador;
+    PoolCortes poolCortes;
+    BusquedaLocal busquedaLocal;
+    vector<unique_ptr<HeuristicaPrimal>> heuristicas;
+
+    // Solución LP de la raíz, para fijar por costo reducido cada vez que baja la cota superior
+    mutable double cotaRaiz;
+    mutable vector<double> valoresYRaiz;
+    mutable vector<double> costosReducidosRaiz;
+    mutable atomic<int> fijadasCostoReducidoRaiz;
+    mutable atomic<int> fijadasCostoReducidoNodo;
+    mutable atomic<int64_t> nanosegundosRelajacion;
+
+    // Estado de la última resolución, para reoptimizar tras un CambioProblema
+    bool estadoVigente;             // hubo una resolución y su estado corresponde a su problema
+    bool reoptimizando;             // la resolución en curso parte del estado anterior
+    bool cambiaronDemandas;         // en la reoptimización en curso (los cortes dejan de servir)
+    vector<double> demandasAnteriores;
+    vector<double> costosAnteriores;
+    vector<double> solucionAnterior;
+    vector<unsigned char> baseRaiz; // base LP de la raíz, con los cortes
+    double cotaAnterior;            // cota inferior global con la que terminó
+    double cotaHeredada;            // cota válida para la reoptimización en curso; -1e20 si no hay
     
-    priority_queue<shared_ptr<NodoArbol>, vector<shared_ptr<NodoArbol>>, ComparadorNodos> colaNodos;
-    
-    void resolverRelajacionLP(const Problema& problema, shared_ptr<NodoArbol> nodo);
+    void cargarDatos(const Problema& problema);
+    void prepararRelajacion(const Problema& problema);
+    void aprovecharSolucionAnterior(const Problema& problema, vector<double>& solucion, double& costo);
+    void guardarEstado(const Problema& problema, const ResultadoSolucion& resultado);
+    void iniciarReloj(chrono::high_resolution_clock::time_point inicio);
+    bool limiteAlcanzado(int iteraciones, const ArenaNodos& arena, const AlmacenBases& bases,
+                         MotivoTerminacion& motivo) const;
+    void completarResultado(ResultadoSolucion& resultado, MotivoTerminacion motivo) const;
+    bool progresoPendiente() const;
+    void reportarProgreso(int nodos, size_t abiertos, double cotaSup, double cotaInf) const;
+    NodoCompacto* crearNodoHijo(ArenaNodos& arena, const NodoCompacto* padre) const;
+    void fijarFuentesGratis(NodoCompacto* nodoRaiz) const;
+    EstadoNodo acotarNodo(ModeloRelajacionLP& modelo, RelajacionLagrangeana& relajacion, AlmacenBases& bases,
+                          NodoCompacto* nodo, const unsigned char* baseInicial, double cotaSup,
+                          vector<double>& solucionY) const;
+    EstadoNodo resolverRelajacionLP(ModeloRelajacionLP& modelo, AlmacenBases& bases, NodoCompacto* nodo,
+                                    const unsigned char* baseInicial, double cotaSup, vector<double>& solucionY) const;
+    int fijarPorCostoReducido(const double* valoresY, const double* costosReducidos, double cota, double cotaSup,
+                              NodoCompacto* nodo) const;
+    bool aplicarFijacionesRaiz(NodoCompacto* nodo, double cotaSup) const;
+    void reportarFijaciones() const;
+    EstadoNodo resolverRelajacionLagrangeana(RelajacionLagrangeana& relajacion, AlmacenBases& bases, NodoCompacto* nodo,
+                                             const unsigned char* multiplicadores, double cotaSup,
+                                             vector<double>& solucionY) const;
+    size_t tamanoEstadoNodo() const;
+    void separarCortesRaiz(const Problema& problema);
+    void compararCotaRaiz(const Problema& problema, double cotaLagrangeana, double segundosLagrangeana);
+    void liberarNodo(ArenaNodos& arena, AlmacenBases& bases, NodoCompacto* nodo) const;
     double calcularCostoExacto(const Problema& problema, const vector<double>& solucion);
-    vector<double> getSolucionGreedy(const Problema& problema);
-    void podarNodos(double mejorCotaSup);
+    bool mejorarSolucionInicial(const Problema& problema, vector<double>& solucion, double& costo);
+    void pulirSolucion(BusquedaLocal& busqueda, EvaluadorTransporte& evaluadorHilo, vector<double>& solucion, double& costo,
+                       double cotaSup, int iteracion, int& ultimaIteracion) const;
+    bool tocaHeuristica(int nodoFraccionario) const;
+    bool ejecutarHeuristicas(const Problema& problema, ModeloRelajacionLP& modelo, EvaluadorTransporte& evaluadorHilo,
+                             const NodoCompacto* nodo, const vector<double>& solucionY, const vector<double>& incumbente,
+                             double cotaSup, int nodoFraccionario, vector<double>& solucion, double& costo) const;
+    void reportarHeuristicas() const;
+    vector<double> getSolucionGreedy(const Problema& problema) const;
+    void podarNodos(PoolNodos& pool, ArenaNodos& arena, AlmacenBases& bases, double mejorCotaSup) const;
     bool esOptimo(double cotaInf, double cotaSup) const;
     
 public:
-    StrategyBranchAndBound(const Problema& problema, int maxIter, double tol);
+    StrategyBranchAndBound(const Problema& problema, int maxIter, double tol, PoliticaSeleccion pol = MEJOR_PRIMERO,
+                           ModoAcotamiento modo = COTA_LP, TipoRamificacion rama = RAMA_MAS_FRACCIONARIA,
+                           bool cortes = true);
     
     ResultadoSolucion resolver(const Problema& problema) override;
+    ResultadoSolucion reoptimizar(const Problema& problema, const CambioProblema& cambio) override;
     string getNombre() const override { return "Ramificación y Acotamiento Mejorado"; }
+    string getParametros() const override;
+    void setFrecuenciaBusquedaLocal(int nodos);
+    void setLimiteTiempo(double segundos);
+    void setLimiteMemoria(double megabytes);
+    void setIntervaloProgreso(double segundos);
+    const vector<unique_ptr<HeuristicaPrimal>>& getHeuristicas() const;
 };
 
 #endif // STRATEGY_BRANCH_AND_BOUND_H
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include "StrategyBranchAndBoundParalelo.h"
+
+/**
+ * Desc: Constructor de la estrategia Branch and Bound paralela.
+ *       Si se piden 0 hilos o menos, usa los núcleos disponibles en la máquina.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - maxIter: Número máximo de nodos a procesar entre todos los hilos.
+ *   - tol: Tolerancia para determinar la optimalidad.
+ *   - hilos: Número de hilos trabajadores.
+ *   - pol: Política de selección de nodos abiertos.
+ *   - modo: Cota de cada nodo: relajación LP (Clp) o relajación Lagrangeana.
+ *   - rama: Regla de ramificación, compartida por los hilos (los pseudo-costos son comunes).
+ *   - cortes: Si se separan cortes en la raíz; cada hilo carga el mismo pool en su modelo.
+ * Returns: void
+ */
+StrategyBranchAndBoundParalelo::StrategyBranchAndBoundParalelo(const Problema& problema, int maxIter, double tol, int hilos,
+                                                               PoliticaSeleccion pol, ModoAcotamiento modo, TipoRamificacion rama,
+                                                               bool cortes)
+    : StrategyBranchAndBound(problema, maxIter, tol, pol, modo, rama, cortes), numHilos(hilos), hilosActivos(0), detener(false),
+      motivoParada(TERMINO_OPTIMO), mejorCotaSup(1e20), iteraciones(0), hayIncumbente(false) {
+    if (numHilos <= 0) {
+        numHilos = max(1u, thread::hardware_concurrency());
+    }
+}
+
+/**
+ * Desc: Devuelve el número de hilos trabajadores configurado.
+ * Params: void
+ * Returns:
+ *   - int: Número de hilos.
+ */
+int StrategyBranchAndBoundParalelo::getNumHilos() const { return numHilos; }
+
+/**
+ * Desc: Describe la configuración de la estrategia, agregando el número de hilos
+ *       a la de la versión secuencial.
+ * Params: void
+ * Returns:
+ *   - string: Parámetros en una línea.
+ */
+string StrategyBranchAndBoundParalelo::getParametros() const {
+    return StrategyBranchAndBound::getParametros() + " hilos=" + to_string(numHilos);
+}
+
+/**
+ * Desc: Resuelve el problema con varios hilos que comparten un pool de nodos
+ *       (una cola local por hilo más un heap global) y una cota superior atómica.
+ *       Cada hilo mantiene su propia relajación persistente (con los cortes de la raíz),
+ *       su evaluador de transporte y su búsqueda local; las heurísticas primales son
+ *       comunes y solo acumulan sus estadísticas bajo su propio mutex.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ * Returns:
+ *   - ResultadoSolucion: Estructura que contiene la solución óptima encontrada,
+ *                         incluyendo costo, tiempo de ejecución y factibilidad.
+ */
+ResultadoSolucion StrategyBranchAndBoundParalelo::resolver(const Problema& problema) {
+    auto tiempoInicio = chrono::high_resolution_clock::now();
+    ResultadoSolucion resultado;
+    iniciarReloj(tiempoInicio);
+    instrumentacion.reiniciar();
+    cargarDatos(problema);
+    costosReducidosRaiz.clear();
+    fijadasCostoReducidoRaiz = 0;
+    fijadasCostoReducidoNodo = 0;
+    nanosegundosRelajacion = 0;
+
+    poolNodos = make_unique<PoolNodos>(numHilos, politica);
+    arena = make_unique<ArenaNodos>(problema.getNumFuentesProd());
+    hilosActivos = 0;
+    detener = false;
+    motivoParada = TERMINO_OPTIMO;
+    iteraciones = 0;
+    hayIncumbente = false;
+
+    // Solución greedy inicial
+    evaluador.construir(problema);
+    mejorSolucion = getSolucionGreedy(problema);
+    double costoInicial = calcularCostoExacto(problema, mejorSolucion);
+    cout << "Solución greedy inicial - Costo: " << costoInicial << "\n";
+    aprovecharSolucionAnterior(problema, mejorSolucion, costoInicial);
+    mejorarSolucionInicial(problema, mejorSolucion, costoInicial);
+    mejorCotaSup = costoInicial;
+    hayIncumbente = costoInicial < 1e20;
+
+    // Nodo raíz, resuelto por el hilo principal
+    prepararRelajacion(problema);
+    if (hayIncumbente && costoInicial <= cotaHeredada + tolerancia) {
+        cout << "Cota de la resolución anterior alcanzada - Costo: " << costoInicial << "\n";
+        arena.reset();
+        poolNodos.reset();
+        resultado.esFactible = true;
+        resultado.solucionFinal = mejorSolucion;
+        resultado.valorObjetivo = costoInicial;
+        resultado.cotaRaiz = resultado.cotaInferior = min(costoInicial, cotaHeredada);
+        completarResultado(resultado, TERMINO_OPTIMO);
+        guardarEstado(problema, resultado);
+        resultado.estadisticas = instrumentacion.obtenerEstadisticas();
+        resultado.tiempoEjecucion =
+            chrono::duration<double>(chrono::high_resolution_clock::now() - tiempoInicio).count();
+        return resultado;
+    }
+    bases = make_unique<AlmacenBases>(tamanoEstadoNodo());
+    vector<double> solucionY;
+    NodoCompacto* nodoRaiz = arena->crear();
+    CONTAR_INSTRUMENTACION(instrumentacion, contarCreado());
+    fijarFuentesGratis(nodoRaiz);
+    auto inicioRaiz = chrono::high_resolution_clock::now();
+    EstadoNodo estadoRaiz = acotarNodo(modeloLP, lagrangeana, *bases, nodoRaiz, nullptr, mejorCotaSup, solucionY);
+    if (modoAcotamiento == COTA_LP) {
+        baseRaiz = modeloLP.obtenerBase();
+    }
+    if (estadoRaiz == NODO_INFACTIBLE) {
+        // La raíz también se descarta si su cota no baja del incumbente inicial
+        resultado.esFactible = hayIncumbente;
+        if (hayIncumbente) {
+            resultado.solucionFinal = mejorSolucion;
+            resultado.valorObjetivo = mejorCotaSup;
+        }
+        resultado.cotaInferior = mejorCotaSup;
+        completarResultado(resultado, TERMINO_OPTIMO);
+        guardarEstado(problema, resultado);
+        resultado.estadisticas = instrumentacion.obtenerEstadisticas();
+        resultado.tiempoEjecucion =
+            chrono::duration<double>(chrono::high_resolution_clock::now() - tiempoInicio).count();
+        return resultado;
+    }
+    if (modoAcotamiento == COTA_LAGRANGEANA) {
+        auto finRaiz = chrono::high_resolution_clock::now();
+        compararCotaRaiz(problema, nodoRaiz->cotaInferior, chrono::duration<double>(finRaiz - inicioRaiz).count());
+    }
+    resultado.cotaRaiz = nodoRaiz->cotaInferior;
+    if (estadoRaiz == NODO_ENTERO || estadoRaiz == NODO_CANDIDATO) {
+        actualizarIncumbente(calcularCostoExacto(problema, solucionY), solucionY);
+    }
+    vector<double> solucionHeuristica;
+    double costoHeuristica;
+    int ultimaBusquedaLocal = 0;
+    if (estadoRaiz == NODO_FRACCIONARIO &&
+        ejecutarHeuristicas(problema, modeloLP, evaluador, nodoRaiz, solucionY, mejorSolucion, mejorCotaSup, 0,
+                            solucionHeuristica, costoHeuristica)) {
+        pulirSolucion(busquedaLocal, evaluador, solucionHeuristica, costoHeuristica, mejorCotaSup, 0, ultimaBusquedaLocal);
+        actualizarIncumbente(costoHeuristica, solucionHeuristica);
+    }
+    if (estadoRaiz != NODO_ENTERO && nodoRaiz->cotaInferior <= mejorCotaSup + tolerancia) {
+        poolNodos->insertar(0, nodoRaiz);
+    } else {
+        liberarNodo(*arena, *bases, nodoRaiz);
+    }
+
+    vector<thread> hilos;
+    for (int h = 0; h < numHilos; h++) {
+        hilos.emplace_back(&StrategyBranchAndBoundParalelo::trabajador, this, cref(problema), h);
+    }
+    for (auto& hilo : hilos) {
+        hilo.join();
+    }
+    resultado.cotaInferior = poolNodos->vacio() ? mejorCotaSup.load() : min(mejorCotaSup.load(), poolNodos->mejorCotaInferior());
+    resultado.cotaInferior = max(resultado.cotaInferior, min(mejorCotaSup.load(), cotaHeredada));
+    resultado.tiempoRelajacion = nanosegundosRelajacion * 1e-9;
+    poolNodos.reset();
+    bases.reset();
+    arena.reset();
+    reportarHeuristicas();
+    reportarFijaciones();
+
+    resultado.numIteraciones = iteraciones;
+    resultado.esFactible = hayIncumbente;
+    if (resultado.esFactible) {
+        resultado.solucionFinal = mejorSolucion;
+        resultado.valorObjetivo = mejorCotaSup;
+    }
+    completarResultado(resultado, motivoParada);
+    guardarEstado(problema, resultado);
+    resultado.estadisticas = instrumentacion.obtenerEstadisticas();
+#ifdef INSTRUMENTACION
+    resultado.estadisticas.imprimir();
+#endif
+    auto tiempoFin = chrono::high_resolution_clock::now();
+    resultado.tiempoEjecucion = chrono::duration<double>(tiempoFin - tiempoInicio).count();
+    return resultado;
+}
+
+/**
+ * Desc: Ciclo de un hilo trabajador. Toma un nodo del pool (su cola local, el heap
+ *       global o la cola de otro hilo), lo poda contra la cota superior global o lo
+ *       ramifica, y deja sus hijos en su cola local.
+ *       Un hilo cuenta como activo desde que intenta extraer hasta que publica sus
+ *       hijos, así que el pool vacío sin hilos activos significa que no quedan nodos.
+ *       También termina cuando se alcanza el máximo de iteraciones o el límite de tiempo
+ *       o de memoria; los límites se revisan antes de ramificar, así que un nodo tomado
+ *       después de alcanzarlos vuelve al pool y nunca se pasa de maxIteraciones.
+ * Params:
+ *   - problema: Referencia constante al problema a resolver.
+ *   - id: Índice del hilo (su cola local en el pool).
+ * Returns: void
+ */
+void StrategyBranchAndBoundParalelo::trabajador(const Problema& problema, int id) {
+    ModeloRelajacionLP modelo;
+    RelajacionLagrangeana relajacion;
+    {
+        MEDIR_FASE(instrumentacion, FASE_CONSTRUIR_RELAJACION);
+        if (modoAcotamiento == COTA_LP) {
+            modelo.construir(problema, estructuraLP);
+            modelo.agregarCortes(poolCortes);
+        } else {
+            relajacion.construir(problema);
+        }
+    }
+    EvaluadorTransporte evaluadorLocal;
+    evaluadorLocal.construir(problema);
+    BusquedaLocal busquedaLocalHilo;
+    busquedaLocalHilo.construir(problema);
+    int ultimaBusquedaLocal = 0;
+    vector<double> solucionY;
+    vector<double> incumbente;
+    vector<double> solucionHeuristica;
+    double costoHeuristica;
+    int nodosFraccionarios = 1;  // la raíz la resolvió el hilo principal
+
+    while (true) {
+        MotivoTerminacion motivo;
+        bool limite = limiteAlcanzado(iteraciones, *arena, *bases, motivo);
+        {
+            lock_guard<mutex> lock(mtxCola);
+            if (limite && !detener) {
+                detener = true;
+                motivoParada = motivo;
+                cvCola.notify_all();
+            }
+            if (detener) {
+                break;
+            }
+            hilosActivos++;
+        }
+
+        NodoCompacto* nodoActual;
+        {
+            MEDIR_FASE(instrumentacion, FASE_COLA);
+            nodoActual = poolNodos->extraer(id);
+        }
+        if (!nodoActual) {
+            unique_lock<mutex> lock(mtxCola);
+            hilosActivos--;
+            if (hilosActivos == 0 && poolNodos->vacio()) {
+                cvCola.notify_all();
+                break;
+            }
+            cvCola.wait(lock, [this] { return detener || !poolNodos->vacio() || hilosActivos == 0; });
+            continue;
+        }
+
+        // La iteración se reserva al tomar el nodo: si otro hilo agotó un límite mientras
+        // tanto, el nodo vuelve al pool sin ramificarse y sigue contando para la cota global
+        if (limiteAlcanzado(iteraciones++, *arena, *bases, motivo)) {
+            iteraciones--;
+            poolNodos->insertar(id, nodoActual);
+            {
+                lock_guard<mutex> lock(mtxCola);
+                if (!detener) {
+                    detener = true;
+                    motivoParada = motivo;
+                }
+                hilosActivos--;
+            }
+            cvCola.notify_all();
+            break;
+        }
+
+        // Poda por cota contra el incumbente global (todo se poda si ya alcanzó la cota heredada)
+        if (nodoActual->cotaInferior < mejorCotaSup + tolerancia && mejorCotaSup > cotaHeredada + tolerancia) {
+            int varIdx = nodoActual->varRamificacion;
+            const unsigned char* basePadre = bases->obtener(nodoActual->idxBase);
+            for (int valor : {0, 1}) {
+                NodoCompacto* nuevoNodo = crearNodoHijo(*arena, nodoActual);
+                nuevoNodo->fijarVariable(varIdx, valor);
+                EstadoNodo estado = acotarNodo(modelo, relajacion, *bases, nuevoNodo, basePadre, mejorCotaSup, solucionY);
+                if (estado != NODO_INFACTIBLE) {
+                    reglaRamificacion->registrarRama(varIdx, valor, nodoActual->valorRamificacion,
+                                                     nodoActual->cotaInferior, nuevoNodo->cotaInferior);
+                }
+
+                if (estado == NODO_ENTERO || estado == NODO_CANDIDATO) {
+                    double costoReal;
+                    {
+                        MEDIR_FASE(instrumentacion, FASE_COSTO_EXACTO);
+                        costoReal = evaluadorLocal.evaluar(solucionY);
+                    }
+                    pulirSolucion(busquedaLocalHilo, evaluadorLocal, solucionY, costoReal, mejorCotaSup, iteraciones,
+                                  ultimaBusquedaLocal);
+                    if (costoReal >= 0) {
+                        actualizarIncumbente(costoReal, solucionY);
+                    }
+                }
+
+                // La copia del incumbente toma el mutex compartido: solo si alguna heurística corre
+                int nodoFraccionario = estado == NODO_FRACCIONARIO ? nodosFraccionarios++ : -1;
+                if (nodoFraccionario >= 0 && tocaHeuristica(nodoFraccionario)) {
+                    double cotaSup;
+                    {
+                        lock_guard<mutex> lock(mtxIncumbente);
+                        incumbente = mejorSolucion;
+                        cotaSup = mejorCotaSup;
+                    }
+                    if (ejecutarHeuristicas(problema, modelo, evaluadorLocal, nuevoNodo, solucionY, incumbente, cotaSup,
+                                            nodoFraccionario, solucionHeuristica, costoHeuristica)) {
+                        pulirSolucion(busquedaLocalHilo, evaluadorLocal, solucionHeuristica, costoHeuristica, cotaSup,
+                                      iteraciones, ultimaBusquedaLocal);
+                        actualizarIncumbente(costoHeuristica, solucionHeuristica);
+                    }
+                }
+
+                bool abierto = estado == NODO_FRACCIONARIO || estado == NODO_CANDIDATO;
+                if (abierto && nuevoNodo->cotaInferior <= mejorCotaSup + tolerancia) {
+                    MEDIR_FASE(instrumentacion, FASE_COLA);
+                    poolNodos->insertar(id, nuevoNodo);
+                } else {
+                    if (abierto) {
+                        CONTAR_INSTRUMENTACION(instrumentacion, contarPodadoPorCota());
+                    }
+                    liberarNodo(*arena, *bases, nuevoNodo);
+                }
+            }
+        } else {
+            CONTAR_INSTRUMENTACION(instrumentacion, contarPodadoPorCota());
+        }
+        liberarNodo(*arena, *bases, nodoActual);
+        if (id == 0 && progresoPendiente()) {
+            double cotaSup = mejorCotaSup;
+            reportarProgreso(iteraciones, poolNodos->tamano(), cotaSup,
+                             poolNodos->vacio() ? cotaSup : min(cotaSup, poolNodos->mejorCotaInferior()));
+        }
+
+        {
+            lock_guard<mutex> lock(mtxCola);
+            hilosActivos--;
+        }
+        cvCola.notify_all();
+    }
+    cvCola.notify_all();
+}
+
+/**
+ * Desc: Publica una nueva solución entera si mejora la cota superior global.
+ *       La cota se actualiza atómicamente para que los demás hilos poden de inmediato.
+ * Params:
+ *   - costo: Costo exacto de la solución encontrada.
+ *   - solucion: Vector de activación de fuentes de la solución.
+ * Returns:
+ *   - bool: True si la solución reemplazó al incumbente.
+ */
+bool StrategyBranchAndBoundParalelo::actualizarIncumbente(double costo, const vector<double>& solucion) {
+    lock_guard<mutex> lock(mtxIncumbente);
+    // Solo una mejora estricta: aceptar empates dentro de la tolerancia dejaría subir el incumbente
+    if (costo >= mejorCotaSup.load() - tolerancia) {
+        return false;
+    }
+    mejorCotaSup.store(costo);
+    mejorSolucion = solucion;
+    hayIncumbente = true;
+    return true;
+}
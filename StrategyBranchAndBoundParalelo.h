@@ -0,0 +1,46 @@
+#ifndef STRATEGY_BRANCH_AND_BOUND_PARALELO_H
+#define STRATEGY_BRANCH_AND_BOUND_PARALELO_H
+
+#include "StrategyBranchAndBound.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+using namespace std;
+
+class StrategyBranchAndBoundParalelo : public StrategyBranchAndBound {
+private:
+    int numHilos;
+
+    // Estado compartido entre hilos durante una resolución
+    unique_ptr<PoolNodos> poolNodos;
+    unique_ptr<ArenaNodos> arena;
+    unique_ptr<AlmacenBases> bases;
+    mutex mtxCola;
+    condition_variable cvCola;
+    int hilosActivos;
+    bool detener;
+    MotivoTerminacion motivoParada;  // límite que activó detener
+
+    atomic<double> mejorCotaSup;
+    atomic<int> iteraciones;
+    mutex mtxIncumbente;
+    vector<double> mejorSolucion;
+    bool hayIncumbente;
+
+    void trabajador(const Problema& problema, int id);
+    bool actualizarIncumbente(double costo, const vector<double>& solucion);
+
+public:
+    StrategyBranchAndBoundParalelo(const Problema& problema, int maxIter, double tol, int hilos,
+                                   PoliticaSeleccion pol = MEJOR_PRIMERO, ModoAcotamiento modo = COTA_LP,
+                                   TipoRamificacion rama = RAMA_MAS_FRACCIONARIA, bool cortes = true);
+
+    ResultadoSolucion resolver(const Problema& problema) override;
+    string getNombre() const override { return "Ramificación y Acotamiento Paralelo"; }
+    string getParametros() const override;
+    int getNumHilos() const;
+};
+
+#endif // STRATEGY_BRANCH_AND_BOUND_PARALELO_H
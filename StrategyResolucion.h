@@ -3,11 +3,22 @@
 
 #include "Problema.h"
 #include "NodoArbol.h"
+#include "Instrumentacion.h"
 #include <memory>
 #include <vector>
+#include <cmath>
+#include <algorithm>
 
 using namespace std;
 
+enum MotivoTerminacion {
+    TERMINO_OPTIMO,              // árbol agotado o brecha dentro de la tolerancia
+    TERMINO_INFACTIBLE,          // árbol agotado sin solución factible
+    TERMINO_LIMITE_ITERACIONES,
+    TERMINO_LIMITE_TIEMPO,
+    TERMINO_LIMITE_MEMORIA       // memoria de los nodos abiertos
+};
+
 class ResultadoSolucion {
 public:
     double valorObjetivo;
@@ -15,15 +26,54 @@ public:
     bool esFactible;
     int numIteraciones;
     double tiempoEjecucion;
+    double cotaRaiz;          // cota inferior de la raíz
+    double cotaInferior;      // mejor cota inferior global al terminar
+    double tiempoRelajacion;  // segundos en acotar nodos (sumados entre hilos)
+    double brecha;            // (valorObjetivo - cotaInferior) / |valorObjetivo|; 1e20 sin solución
+    MotivoTerminacion motivoTerminacion;
+    EstadisticasResolucion estadisticas;  // en cero si se compiló sin INSTRUMENTACION
+    bool desdeCache;          // recuperado de la caché de resultados, sin resolver
     
-    ResultadoSolucion() : valorObjetivo(1e9), esFactible(false), numIteraciones(0), tiempoEjecucion(0.0) {}
+    ResultadoSolucion() : valorObjetivo(1e9), esFactible(false), numIteraciones(0), tiempoEjecucion(0.0), cotaRaiz(0.0),
+                          cotaInferior(0.0), tiempoRelajacion(0.0), brecha(1e20), motivoTerminacion(TERMINO_OPTIMO), desdeCache(false) {}
+
+    // Recalcula la brecha relativa a partir del valor objetivo y la cota inferior
+    void actualizarBrecha() {
+        brecha = esFactible ? max(0.0, valorObjetivo - cotaInferior) / (1e-10 + abs(valorObjetivo)) : 1e20;
+    }
+
+    bool alcanzoLimite() const {
+        return motivoTerminacion != TERMINO_OPTIMO && motivoTerminacion != TERMINO_INFACTIBLE;
+    }
+
+    static string nombreMotivo(MotivoTerminacion motivo) {
+        switch (motivo) {
+            case TERMINO_OPTIMO:
+                return "óptimo";
+            case TERMINO_INFACTIBLE:
+                return "infactible";
+            case TERMINO_LIMITE_ITERACIONES:
+                return "límite de iteraciones";
+            case TERMINO_LIMITE_TIEMPO:
+                return "límite de tiempo";
+            default:
+                return "límite de memoria";
+        }
+    }
 };
 
 class StrategyResolucion {
 public:
     virtual ~StrategyResolucion() = default;
     virtual ResultadoSolucion resolver(const Problema& problema) = 0;
+    // Resuelve `problema`, que es el último resuelto con `cambio` aplicado; por
+    // defecto desde cero, las estrategias pueden aprovechar su resolución anterior
+    virtual ResultadoSolucion reoptimizar(const Problema& problema, const CambioProblema& /*cambio*/) {
+        return resolver(problema);
+    }
     virtual string getNombre() const = 0;
+    // Texto con todo lo que influye en el resultado, para la caché de resultados
+    virtual string getParametros() const { return getNombre(); }
 };
 
 #endif // STRATEGY_RESOLUCION_H
\ No newline at end of file
@@ -0,0 +1,410 @@
+#include "SubproblemaBenders.h"
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <cmath>
+
+static const double EPS_FLUJO = 1e-9;
+static const double INFINITO = 1e20;
+
+/**
+ * Desc: Constructor por defecto. Los datos se cargan en construir().
+ * Params: void
+ * Returns: void
+ */
+SubproblemaBenders::SubproblemaBenders()
+    : numClientes(0), numFuentesProd(0), sinCapacidad(true), demandaTotal(0.0), cotaTransporte(0.0) {}
+
+/**
+ * Desc: Arma una única vez los arcos permitidos de cada cliente ordenados por costo
+ *       (lo que usa la separación por cliente) y los arcos que llegan a cada fuente
+ *       (los inversos del flujo). Decide además si las capacidades pueden activarse:
+ *       si toda fuente alcanza para la demanda total, el subproblema se separa por cliente.
+ * Params:
+ *   - problema: Referencia constante al problema.
+ * Returns: void
+ */
+void SubproblemaBenders::construir(const Problema& problema) {
+    numClientes = problema.getNumClientes();
+    numFuentesProd = problema.getNumFuentesProd();
+    capacidades = problema.getCapacidades();
+    demandas.assign(numClientes, 0.0);
+    demandaTotal = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        demandas[i] = problema.getDemanda(i);
+        demandaTotal += demandas[i];
+    }
+    sinCapacidad = all_of(capacidades.begin(), capacidades.end(), [this](double cap) { return cap >= demandaTotal; });
+
+    inicioCliente.assign(numClientes + 1, 0);
+    fuenteArco.clear();
+    clienteArco.clear();
+    costoArco.clear();
+    cotaTransporte = 0.0;
+    vector<int> orden(numFuentesProd);
+    for (int i = 0; i < numClientes; i++) {
+        VistaCostos costosCliente = problema.getCostosCliente(i);
+        iota(orden.begin(), orden.end(), 0);
+        stable_sort(orden.begin(), orden.end(), [&costosCliente](int a, int b) { return costosCliente[a] < costosCliente[b]; });
+        for (int j : orden) {
+            if (problema.esArcoPermitido(i, j)) {
+                fuenteArco.push_back(j);
+                clienteArco.push_back(i);
+                costoArco.push_back(costosCliente[j]);
+            }
+        }
+        inicioCliente[i + 1] = fuenteArco.size();
+        if (inicioCliente[i + 1] > inicioCliente[i]) {
+            cotaTransporte += demandas[i] * costoArco[inicioCliente[i]];
+        }
+    }
+
+    int numArcos = fuenteArco.size();
+    inicioFuente.assign(numFuentesProd + 1, 0);
+    for (int p = 0; p < numArcos; p++) {
+        inicioFuente[fuenteArco[p] + 1]++;
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        inicioFuente[j + 1] += inicioFuente[j];
+    }
+    arcosFuente.assign(numArcos, 0);
+    vector<int> siguiente(inicioFuente.begin(), inicioFuente.end() - 1);
+    for (int p = 0; p < numArcos; p++) {
+        arcosFuente[siguiente[fuenteArco[p]]++] = p;
+    }
+
+    int numNodos = numClientes + numFuentesProd + 1;
+    flujo.assign(numArcos, 0.0);
+    exceso.assign(numClientes, 0.0);
+    capacidadResidual.assign(numFuentesProd, 0.0);
+    potencial.assign(numNodos, 0.0);
+    distancia.assign(numNodos, INFINITO);
+    arcoPrevio.assign(numNodos, -1);
+    duales.assign(numFuentesProd, 0.0);
+}
+
+/**
+ * Desc: Indica si el subproblema se separa por cliente (ninguna capacidad puede activarse).
+ * Params: void
+ * Returns:
+ *   - bool: True si toda fuente tiene capacidad para la demanda total.
+ */
+bool SubproblemaBenders::esSinCapacidad() const { return sinCapacidad; }
+
+/**
+ * Desc: Cota inferior del costo de transporte para cualquier y: cada cliente
+ *       abastecido por completo desde su fuente permitida más barata.
+ * Params: void
+ * Returns:
+ *   - double: sum_i d_i min_j c_ij.
+ */
+double SubproblemaBenders::getCotaTransporte() const { return cotaTransporte; }
+
+/**
+ * Desc: Resuelve el subproblema de transporte para las aperturas y y arma el corte
+ *       de Benders correspondiente: de optimalidad, que en y vale exactamente Q(y),
+ *       o de factibilidad si con y no se puede abastecer la demanda.
+ * Params:
+ *   - y: Apertura de cada fuente, en [0, 1].
+ *   - corte: Corte resultante.
+ * Returns:
+ *   - double: Costo de transporte Q(y), o 1e20 si es infactible.
+ */
+double SubproblemaBenders::resolver(const vector<double>& y, CorteBenders& corte) {
+    corte.coeficientes.assign(numFuentesProd, 0.0);
+    corte.constante = 0.0;
+    corte.optimalidad = true;
+    return sinCapacidad ? separarPorCliente(y, corte) : resolverFlujo(y, corte);
+}
+
+/**
+ * Desc: Caso sin capacidades: el transporte de cada cliente, con x_ij <= d_i y_j, se
+ *       resuelve llenando su demanda desde las fuentes más baratas. Si k es la fuente
+ *       en que la apertura acumulada llega a 1, el dual del cliente es u_i = d_i c_ik
+ *       y cada fuente más barata aporta w_ij = d_i (c_ik - c_ij). El corte agrega los
+ *       de todos los clientes en una sola desigualdad sobre eta.
+ * Params:
+ *   - y: Apertura de cada fuente.
+ *   - corte: Corte resultante.
+ * Returns:
+ *   - double: Costo de transporte Q(y), o 1e20 si algún cliente no alcanza apertura 1.
+ */
+double SubproblemaBenders::separarPorCliente(const vector<double>& y, CorteBenders& corte) const {
+    double costo = 0.0;
+    for (int i = 0; i < numClientes; i++) {
+        double acumulado = 0.0;
+        int critico = -1;
+        for (int p = inicioCliente[i]; p < inicioCliente[i + 1]; p++) {
+            acumulado += max(0.0, y[fuenteArco[p]]);
+            if (acumulado >= 1.0 - EPS_FLUJO) {
+                critico = p;
+                break;
+            }
+        }
+        if (critico < 0) {
+            // El cliente solo puede abastecerse desde sus fuentes permitidas: sum_j y_j >= 1
+            corte.optimalidad = false;
+            corte.coeficientes.assign(numFuentesProd, 0.0);
+            for (int p = inicioCliente[i]; p < inicioCliente[i + 1]; p++) {
+                corte.coeficientes[fuenteArco[p]] = 1.0;
+            }
+            corte.constante = 1.0;
+            return INFINITO;
+        }
+        double costoCritico = costoArco[critico];
+        double costoCliente = costoCritico;
+        for (int p = inicioCliente[i]; p < critico; p++) {
+            double ahorro = demandas[i] * (costoCritico - costoArco[p]);
+            corte.coeficientes[fuenteArco[p]] -= ahorro;
+            costoCliente -= (costoCritico - costoArco[p]) * y[fuenteArco[p]];
+        }
+        corte.constante += demandas[i] * costoCritico;
+        costo += demandas[i] * costoCliente;
+    }
+    return costo;
+}
+
+/**
+ * Desc: Caso con capacidades: flujo de costo mínimo desde los clientes (con oferta d_i)
+ *       a un sumidero, pasando por las fuentes con capacidad M_j y_j, por caminos más
+ *       cortos sucesivos con potenciales. Los arcos cliente -> fuente no tienen cota
+ *       (x_ij <= d_i ya está implícito), así los potenciales finales son duales óptimos:
+ *       w_j = max(0, pi_T - pi_j) es el precio de la capacidad de j y u_i = min_j c_ij + w_j.
+ *       Para las fuentes cerradas se usa el menor w_j que mantiene la factibilidad dual,
+ *       lo que da el corte más fuerte sin cambiar su valor en y.
+ * Params:
+ *   - y: Apertura de cada fuente.
+ *   - corte: Corte resultante.
+ * Returns:
+ *   - double: Costo de transporte Q(y), o 1e20 si las capacidades no alcanzan.
+ */
+double SubproblemaBenders::resolverFlujo(const vector<double>& y, CorteBenders& corte) {
+    int sumidero = numClientes + numFuentesProd;
+    fill(flujo.begin(), flujo.end(), 0.0);
+    for (int j = 0; j < numFuentesProd; j++) {
+        capacidadResidual[j] = capacidades[j] * min(1.0, max(0.0, y[j]));
+        potencial[numClientes + j] = 0.0;
+    }
+    // Potenciales iniciales: cada cliente a distancia reducida 0 de su fuente más barata
+    for (int i = 0; i < numClientes; i++) {
+        exceso[i] = demandas[i];
+        potencial[i] = inicioCliente[i + 1] > inicioCliente[i] ? -costoArco[inicioCliente[i]] : 0.0;
+    }
+    potencial[sumidero] = 0.0;
+
+    // Un cliente que no llega al sumidero queda con exceso; el resto sigue, para que
+    // el corte de factibilidad abarque a todos los clientes que no se pueden abastecer
+    bool factible = true;
+    for (int i = 0; i < numClientes; i++) {
+        while (exceso[i] > EPS_FLUJO) {
+            if (!caminoMasCorto(i)) {
+                factible = false;
+                break;
+            }
+            aumentarFlujo(i);
+        }
+    }
+    if (!factible) {
+        corteFactibilidadFlujo(corte);
+        return INFINITO;
+    }
+
+    double costo = 0.0;
+    for (size_t p = 0; p < flujo.size(); p++) {
+        costo += costoArco[p] * flujo[p];
+    }
+
+    // Duales de las fuentes con capacidad; las cerradas se ajustan después
+    vector<bool> abierta(numFuentesProd);
+    for (int j = 0; j < numFuentesProd; j++) {
+        abierta[j] = capacidades[j] * y[j] > EPS_FLUJO;
+        duales[j] = abierta[j] ? max(0.0, potencial[sumidero] - potencial[numClientes + j]) : 0.0;
+    }
+    vector<double> dualCliente(numClientes, INFINITO);
+    for (int i = 0; i < numClientes; i++) {
+        for (int p = inicioCliente[i]; p < inicioCliente[i + 1]; p++) {
+            if (abierta[fuenteArco[p]]) {
+                dualCliente[i] = min(dualCliente[i], costoArco[p] + duales[fuenteArco[p]]);
+            }
+        }
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (abierta[j]) {
+            continue;
+        }
+        for (int k = inicioFuente[j]; k < inicioFuente[j + 1]; k++) {
+            int p = arcosFuente[k];
+            duales[j] = max(duales[j], dualCliente[clienteArco[p]] - costoArco[p]);
+        }
+    }
+
+    for (int i = 0; i < numClientes; i++) {
+        corte.constante += demandas[i] * dualCliente[i];
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        corte.coeficientes[j] = -capacidades[j] * duales[j];
+    }
+    return costo;
+}
+
+/**
+ * Desc: Dijkstra con costos reducidos desde un cliente con exceso hasta el sumidero,
+ *       por el grafo residual: cliente -> fuente (siempre), fuente -> cliente (si hay
+ *       flujo) y fuente -> sumidero (si queda capacidad). Al llegar al sumidero
+ *       actualiza los potenciales, con la distancia del sumidero como tope para los
+ *       nodos no cerrados, para mantener no negativos los costos reducidos.
+ * Params:
+ *   - cliente: Cliente de origen.
+ * Returns:
+ *   - bool: True si se alcanzó el sumidero.
+ */
+bool SubproblemaBenders::caminoMasCorto(int cliente) {
+    int sumidero = numClientes + numFuentesProd;
+    fill(distancia.begin(), distancia.end(), INFINITO);
+    fill(arcoPrevio.begin(), arcoPrevio.end(), -1);
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> cola;
+    distancia[cliente] = 0.0;
+    cola.push({0.0, cliente});
+
+    auto relajar = [&](int nodo, double d, int arco) {
+        if (d < distancia[nodo]) {
+            distancia[nodo] = d;
+            arcoPrevio[nodo] = arco;
+            cola.push({d, nodo});
+        }
+    };
+
+    while (!cola.empty()) {
+        auto [d, u] = cola.top();
+        cola.pop();
+        if (d > distancia[u]) {
+            continue;
+        }
+        if (u == sumidero) {
+            break;
+        }
+        if (u < numClientes) {
+            for (int p = inicioCliente[u]; p < inicioCliente[u + 1]; p++) {
+                int v = numClientes + fuenteArco[p];
+                relajar(v, d + max(0.0, costoArco[p] + potencial[u] - potencial[v]), p);
+            }
+        } else {
+            int j = u - numClientes;
+            if (capacidadResidual[j] > EPS_FLUJO) {
+                // En el sumidero, el arco previo es el índice de la fuente
+                relajar(sumidero, d + max(0.0, potencial[u] - potencial[sumidero]), j);
+            }
+            for (int k = inicioFuente[j]; k < inicioFuente[j + 1]; k++) {
+                int p = arcosFuente[k];
+                if (flujo[p] > EPS_FLUJO) {
+                    int v = clienteArco[p];
+                    relajar(v, d + max(0.0, -costoArco[p] + potencial[u] - potencial[v]), p);
+                }
+            }
+        }
+    }
+
+    double distanciaSumidero = distancia[sumidero];
+    if (distanciaSumidero >= INFINITO) {
+        return false;
+    }
+    for (size_t v = 0; v < potencial.size(); v++) {
+        potencial[v] += min(distancia[v], distanciaSumidero);
+    }
+    return true;
+}
+
+/**
+ * Desc: Envía por el camino que dejó caminoMasCorto() todo el flujo que admite:
+ *       el exceso del cliente, la capacidad residual de la última fuente y el flujo
+ *       de los arcos recorridos en sentido inverso.
+ * Params:
+ *   - cliente: Cliente de origen del camino.
+ * Returns: void
+ */
+void SubproblemaBenders::aumentarFlujo(int cliente) {
+    int sumidero = numClientes + numFuentesProd;
+    int ultimaFuente = arcoPrevio[sumidero];
+    double delta = min(exceso[cliente], capacidadResidual[ultimaFuente]);
+    int nodo = numClientes + ultimaFuente;
+    while (nodo != cliente) {
+        int p = arcoPrevio[nodo];
+        if (nodo >= numClientes) {
+            nodo = clienteArco[p];
+        } else {
+            delta = min(delta, flujo[p]);
+            nodo = numClientes + fuenteArco[p];
+        }
+    }
+
+    capacidadResidual[ultimaFuente] -= delta;
+    exceso[cliente] -= delta;
+    nodo = numClientes + ultimaFuente;
+    while (nodo != cliente) {
+        int p = arcoPrevio[nodo];
+        if (nodo >= numClientes) {
+            flujo[p] += delta;
+            nodo = clienteArco[p];
+        } else {
+            flujo[p] -= delta;
+            nodo = numClientes + fuenteArco[p];
+        }
+    }
+}
+
+/**
+ * Desc: Corte de factibilidad cuando quedan clientes con exceso. Desde ellos se recorre
+ *       el grafo residual (cliente -> fuente permitida, fuente -> cliente con flujo): los
+ *       clientes alcanzados solo pueden abastecerse desde las fuentes alcanzadas, que
+ *       quedaron todas sin capacidad, así que sum_{j alcanzada} M_j y_j >= sum_{i alcanzado} d_i
+ *       vale para toda solución y no se cumple en el y actual.
+ * Params:
+ *   - corte: Corte resultante.
+ * Returns: void
+ */
+void SubproblemaBenders::corteFactibilidadFlujo(CorteBenders& corte) {
+    fill(distancia.begin(), distancia.end(), INFINITO);
+    vector<int> pendientes;
+    for (int i = 0; i < numClientes; i++) {
+        if (exceso[i] > EPS_FLUJO) {
+            distancia[i] = 0.0;
+            pendientes.push_back(i);
+        }
+    }
+    while (!pendientes.empty()) {
+        int u = pendientes.back();
+        pendientes.pop_back();
+        if (u < numClientes) {
+            for (int p = inicioCliente[u]; p < inicioCliente[u + 1]; p++) {
+                int v = numClientes + fuenteArco[p];
+                if (distancia[v] >= INFINITO) {
+                    distancia[v] = 0.0;
+                    pendientes.push_back(v);
+                }
+            }
+        } else {
+            int j = u - numClientes;
+            for (int k = inicioFuente[j]; k < inicioFuente[j + 1]; k++) {
+                int p = arcosFuente[k];
+                if (flujo[p] > EPS_FLUJO && distancia[clienteArco[p]] >= INFINITO) {
+                    distancia[clienteArco[p]] = 0.0;
+                    pendientes.push_back(clienteArco[p]);
+                }
+            }
+        }
+    }
+
+    corte.optimalidad = false;
+    corte.constante = 0.0;
+    corte.coeficientes.assign(numFuentesProd, 0.0);
+    for (int i = 0; i < numClientes; i++) {
+        if (distancia[i] < INFINITO) {
+            corte.constante += demandas[i];
+        }
+    }
+    for (int j = 0; j < numFuentesProd; j++) {
+        if (distancia[numClientes + j] < INFINITO) {
+            corte.coeficientes[j] = capacidades[j];
+        }
+    }
+}
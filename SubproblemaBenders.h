@@ -0,0 +1,66 @@
+#ifndef SUBPROBLEMA_BENDERS_H
+#define SUBPROBLEMA_BENDERS_H
+
+#include "Problema.h"
+#include <vector>
+
+using namespace std;
+
+// Corte de Benders sobre las variables de apertura y_j. De optimalidad:
+// eta >= constante + sum_j coeficientes[j] y_j; de factibilidad:
+// sum_j coeficientes[j] y_j >= constante.
+struct CorteBenders {
+    bool optimalidad;
+    double constante;
+    vector<double> coeficientes;
+};
+
+// Subproblema de transporte de la descomposición de Benders: dado un y (posiblemente
+// fraccionario), calcula el costo de transporte Q(y) y el corte que lo acota.
+// Sin capacidades efectivas (M_j >= demanda total para toda j) se separa por cliente
+// en forma cerrada; si no, se resuelve un flujo de costo mínimo con capacidades M_j y_j
+// y el corte sale de sus potenciales.
+class SubproblemaBenders {
+private:
+    int numClientes;
+    int numFuentesProd;
+    bool sinCapacidad;
+    double demandaTotal;
+    double cotaTransporte;   // sum_i d_i min_j c_ij, cota inferior de Q(y)
+    vector<double> demandas;
+    vector<double> capacidades;
+
+    // Arcos permitidos por cliente, ordenados por costo (formato CSR)
+    vector<int> inicioCliente;
+    vector<int> fuenteArco;
+    vector<int> clienteArco;
+    vector<double> costoArco;
+    // Arcos que llegan a cada fuente, para recorrer los arcos inversos del flujo
+    vector<int> inicioFuente;
+    vector<int> arcosFuente;
+
+    // Memoria de trabajo del flujo, reutilizada entre llamadas
+    vector<double> flujo;
+    vector<double> exceso;
+    vector<double> capacidadResidual;
+    vector<double> potencial;
+    vector<double> distancia;
+    vector<int> arcoPrevio;
+    vector<double> duales;
+
+    double separarPorCliente(const vector<double>& y, CorteBenders& corte) const;
+    double resolverFlujo(const vector<double>& y, CorteBenders& corte);
+    bool caminoMasCorto(int cliente);
+    void aumentarFlujo(int cliente);
+    void corteFactibilidadFlujo(CorteBenders& corte);
+
+public:
+    SubproblemaBenders();
+
+    void construir(const Problema& problema);
+    bool esSinCapacidad() const;
+    double getCotaTransporte() const;
+    double resolver(const vector<double>& y, CorteBenders& corte);
+};
+
+#endif // SUBPROBLEMA_BENDERS_H
@@ -0,0 +1,470 @@
+#include "Problema.h"
+#include "ResolveCFL.h"
+#include "StrategyBranchAndBound.h"
+#include "StrategyBranchAndBoundParalelo.h"
+#include "StrategyBenders.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <filesystem>
+#include <cmath>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+using namespace std;
+
+// Lo que una corrida devuelve al proceso principal por el pipe
+struct MedicionCorrida {
+    bool ok;
+    bool factible;
+    double valor;
+    double tiempo;
+    int nodos;
+    double cotaRaiz;
+    double cotaInferior;
+    double tiempoRelajacion;
+    long rssMaxKb;
+    char error[128];
+};
+
+struct OpcionesBench {
+    int repeticiones = 3;
+    int hilos = 0;  // 0 = estrategia secuencial
+    int maxIter = 100000;
+    double tolerancia = 1e-6;
+    bool reduccion = true;
+    bool benders = false;  // descomposición de Benders en vez de ramificación y acotamiento
+    string archivoCsv;
+    string archivoJson;
+    vector<string> entradas;
+};
+
+/**
+ * Desc: Brecha relativa entre una cota inferior y el valor de la mejor solución.
+ * Params:
+ *   - valor: Costo de la mejor solución.
+ *   - cota: Cota inferior.
+ * Returns:
+ *   - double: (valor - cota) / |valor|, o -1 si no hay solución.
+ */
+double brechaRelativa(double valor, double cota) {
+    if (valor >= 1e20 || cota >= 1e20) {
+        return -1.0;
+    }
+    return max(0.0, valor - cota) / max(1e-9, abs(valor));
+}
+
+/**
+ * Desc: Expande las entradas de la línea de comandos: los directorios aportan sus
+ *       instancias (.txt y .cflb) en orden alfabético y los archivos van tal cual.
+ * Params:
+ *   - entradas: Archivos o directorios.
+ * Returns:
+ *   - vector<string>: Rutas de las instancias.
+ */
+vector<string> listarInstancias(const vector<string>& entradas) {
+    vector<string> instancias;
+    for (const string& entrada : entradas) {
+        if (!filesystem::is_directory(entrada)) {
+            instancias.push_back(entrada);
+            continue;
+        }
+        vector<string> delDirectorio;
+        for (const auto& archivo : filesystem::directory_iterator(entrada)) {
+            string extension = archivo.path().extension().string();
+            if (archivo.is_regular_file() && (extension == ".txt" || extension == ".cflb")) {
+                delDirectorio.push_back(archivo.path().string());
+            }
+        }
+        sort(delDirectorio.begin(), delDirectorio.end());
+        instancias.insert(instancias.end(), delDirectorio.begin(), delDirectorio.end());
+    }
+    return instancias;
+}
+
+/**
+ * Desc: Resuelve una instancia en un proceso hijo, para medir su memoria máxima por
+ *       separado y aislar fallas. La salida del solver se descarta.
+ * Params:
+ *   - instancia: Ruta de la instancia.
+ *   - opciones: Parámetros del solver.
+ * Returns:
+ *   - MedicionCorrida: Resultado de la corrida (ok = false si falló).
+ */
+MedicionCorrida medirCorrida(const string& instancia, const OpcionesBench& opciones) {
+    MedicionCorrida medicion{};
+    int tubo[2];
+    if (pipe(tubo) != 0) {
+        strncpy(medicion.error, "no se pudo crear el pipe", sizeof(medicion.error) - 1);
+        return medicion;
+    }
+    cout.flush();
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(tubo[0]);
+        int nulo = open("/dev/null", O_WRONLY);
+        dup2(nulo, STDOUT_FILENO);
+        MedicionCorrida hijo{};
+        try {
+            Problema problema(instancia);
+            if (!problema.esValido()) {
+                throw runtime_error("El problema no es válido");
+            }
+            shared_ptr<StrategyResolucion> estrategia;
+            if (opciones.benders) {
+                estrategia = make_shared<StrategyBenders>(problema, opciones.maxIter, opciones.tolerancia);
+            } else if (opciones.hilos > 0) {
+                estrategia = make_shared<StrategyBranchAndBoundParalelo>(problema, opciones.maxIter, opciones.tolerancia,
+                                                                         opciones.hilos);
+            } else {
+                estrategia = make_shared<StrategyBranchAndBound>(problema, opciones.maxIter, opciones.tolerancia);
+            }
+            ResolveCFL resolvedor(estrategia);
+            resolvedor.setReduccion(opciones.reduccion);
+            auto inicio = chrono::high_resolution_clock::now();
+            ResultadoSolucion resultado = resolvedor.resolver(problema);
+            auto fin = chrono::high_resolution_clock::now();
+            hijo.ok = true;
+            hijo.factible = resultado.esFactible;
+            hijo.valor = resultado.esFactible ? resultado.valorObjetivo : 1e20;
+            hijo.tiempo = chrono::duration<double>(fin - inicio).count();
+            hijo.nodos = resultado.numIteraciones;
+            hijo.cotaRaiz = resultado.cotaRaiz;
+            hijo.cotaInferior = resultado.cotaInferior;
+            hijo.tiempoRelajacion = resultado.tiempoRelajacion;
+        } catch (const exception& e) {
+            strncpy(hijo.error, e.what(), sizeof(hijo.error) - 1);
+        }
+        ssize_t escritos = write(tubo[1], &hijo, sizeof(hijo));
+        _exit(escritos == sizeof(hijo) ? 0 : 1);
+    }
+
+    close(tubo[1]);
+    ssize_t leidos = pid > 0 ? read(tubo[0], &medicion, sizeof(medicion)) : -1;
+    close(tubo[0]);
+    int estado = 0;
+    struct rusage uso{};
+    if (pid > 0) {
+        wait4(pid, &estado, 0, &uso);
+    }
+    if (leidos != sizeof(medicion)) {
+        medicion = MedicionCorrida{};
+        strncpy(medicion.error, pid > 0 ? "el proceso terminó sin resultado" : "no se pudo crear el proceso",
+                sizeof(medicion.error) - 1);
+    }
+    medicion.rssMaxKb = uso.ru_maxrss;
+    return medicion;
+}
+
+/**
+ * Desc: Escapa una cadena para un campo de CSV.
+ * Params:
+ *   - texto: Cadena a escapar.
+ * Returns:
+ *   - string: La cadena entre comillas si hace falta.
+ */
+string campoCsv(const string& texto) {
+    if (texto.find_first_of(",\"\n") == string::npos) {
+        return texto;
+    }
+    string escapado = "\"";
+    for (char c : texto) {
+        escapado += c == '"' ? string("\"\"") : string(1, c);
+    }
+    return escapado + "\"";
+}
+
+/**
+ * Desc: Escapa una cadena para JSON.
+ * Params:
+ *   - texto: Cadena a escapar.
+ * Returns:
+ *   - string: La cadena entre comillas, con comillas y barras escapadas.
+ */
+string cadenaJson(const string& texto) {
+    string escapado = "\"";
+    for (char c : texto) {
+        if (c == '"' || c == '\\') {
+            escapado += '\\';
+        }
+        escapado += c;
+    }
+    return escapado + "\"";
+}
+
+/**
+ * Desc: Ejecuta todas las corridas y escribe los reportes pedidos. En consola imprime
+ *       una fila por instancia con la mediana del tiempo.
+ * Params:
+ *   - opciones: Opciones de la línea de comandos.
+ * Returns:
+ *   - int: 0 si todas las corridas terminaron, 1 si alguna falló.
+ */
+int ejecutarBench(const OpcionesBench& opciones) {
+    vector<string> instancias = listarInstancias(opciones.entradas);
+    if (instancias.empty()) {
+        cerr << "Error: No se encontraron instancias\n";
+        return 1;
+    }
+
+    ostringstream csv;
+    ostringstream json;
+    csv << "instancia,repeticion,hilos,factible,valor,tiempo_s,nodos,fraccion_lp,cota_raiz,brecha_raiz,cota_final,"
+           "brecha_final,rss_max_kb\n";
+    json << "[\n";
+    bool primero = true;
+    bool fallas = false;
+    // Hilos que usa de verdad la estrategia elegida: Benders y el secuencial usan uno
+    int hilosUsados = opciones.benders || opciones.hilos == 0 ? 1 : opciones.hilos;
+
+    cout << fixed << setprecision(4);
+    for (const string& instancia : instancias) {
+        vector<double> tiempos;
+        MedicionCorrida ultima{};
+        for (int r = 0; r < opciones.repeticiones; r++) {
+            MedicionCorrida m = medirCorrida(instancia, opciones);
+            if (!m.ok) {
+                cerr << "Error en " << instancia << ": " << m.error << "\n";
+                fallas = true;
+                continue;
+            }
+            tiempos.push_back(m.tiempo);
+            ultima = m;
+            double fraccionLP = m.tiempo > 0 ? m.tiempoRelajacion / (m.tiempo * hilosUsados) : 0.0;
+            double brechaRaiz = brechaRelativa(m.valor, m.cotaRaiz);
+            double brechaFinal = brechaRelativa(m.valor, m.cotaInferior);
+
+            ostringstream valores;
+            valores << setprecision(10) << m.valor << "," << setprecision(6) << m.tiempo << "," << m.nodos << ","
+                    << fraccionLP << "," << setprecision(10) << m.cotaRaiz << "," << setprecision(6) << brechaRaiz
+                    << "," << setprecision(10) << m.cotaInferior << "," << setprecision(6) << brechaFinal << ","
+                    << m.rssMaxKb;
+            csv << campoCsv(instancia) << "," << r << "," << hilosUsados << "," << (m.factible ? 1 : 0) << ","
+                << valores.str() << "\n";
+
+            json << (primero ? "" : ",\n") << "  {\"instancia\": " << cadenaJson(instancia) << ", \"repeticion\": " << r
+                 << ", \"hilos\": " << hilosUsados << ", \"factible\": " << (m.factible ? "true" : "false")
+                 << setprecision(10) << ", \"valor\": " << m.valor << setprecision(6) << ", \"tiempo_s\": " << m.tiempo
+                 << ", \"nodos\": " << m.nodos << ", \"fraccion_lp\": " << fraccionLP << setprecision(10)
+                 << ", \"cota_raiz\": " << m.cotaRaiz << setprecision(6) << ", \"brecha_raiz\": " << brechaRaiz
+                 << setprecision(10) << ", \"cota_final\": " << m.cotaInferior << setprecision(6)
+                 << ", \"brecha_final\": " << brechaFinal << ", \"rss_max_kb\": " << m.rssMaxKb << "}";
+            primero = false;
+        }
+        if (tiempos.empty()) {
+            continue;
+        }
+        sort(tiempos.begin(), tiempos.end());
+        cout << instancia << ": mediana " << tiempos[tiempos.size() / 2] << " s, " << ultima.nodos << " nodos, valor "
+             << ultima.valor << ", brecha final " << brechaRelativa(ultima.valor, ultima.cotaInferior) << ", RSS "
+             << ultima.rssMaxKb << " KB\n";
+    }
+    json << "\n]\n";
+
+    if (!opciones.archivoCsv.empty()) {
+        ofstream(opciones.archivoCsv) << csv.str();
+    }
+    if (!opciones.archivoJson.empty()) {
+        ofstream(opciones.archivoJson) << json.str();
+    }
+    if (opciones.archivoCsv.empty() && opciones.archivoJson.empty()) {
+        cout << "\n" << csv.str();
+    }
+    return fallas ? 1 : 0;
+}
+
+/**
+ * Desc: Lee un CSV generado por bench y agrupa las corridas por instancia.
+ * Params:
+ *   - nombreArchivo: Ruta del CSV.
+ * Returns:
+ *   - map<string, vector<vector<string>>>: Campos de cada corrida, por instancia.
+ * Throws:
+ *   - runtime_error: Si el archivo no se puede abrir o no tiene la cabecera esperada.
+ */
+map<string, vector<vector<string>>> leerCsv(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo);
+    if (!archivo.is_open()) {
+        throw runtime_error("No se pudo abrir el archivo: " + nombreArchivo);
+    }
+    string linea;
+    if (!getline(archivo, linea) || linea.rfind("instancia,", 0) != 0) {
+        throw runtime_error("No es un CSV de bench: " + nombreArchivo);
+    }
+    map<string, vector<vector<string>>> corridas;
+    while (getline(archivo, linea)) {
+        vector<string> campos;
+        string campo;
+        bool entreComillas = false;
+        for (size_t k = 0; k < linea.size(); k++) {
+            char c = linea[k];
+            if (c == '"' && entreComillas && k + 1 < linea.size() && linea[k + 1] == '"') {
+                campo += '"';
+                k++;
+            } else if (c == '"') {
+                entreComillas = !entreComillas;
+            } else if (c == ',' && !entreComillas) {
+                campos.push_back(campo);
+                campo.clear();
+            } else {
+                campo += c;
+            }
+        }
+        campos.push_back(campo);
+        if (campos.size() >= 13) {
+            corridas[campos[0]].push_back(campos);
+        }
+    }
+    return corridas;
+}
+
+/**
+ * Desc: Compara dos CSV de bench: por instancia común muestra la mediana del tiempo
+ *       de cada uno, la razón entre ellas y los nodos, y marca los valores objetivo
+ *       distintos. Termina con la media geométrica de las razones.
+ * Params:
+ *   - base: CSV de referencia.
+ *   - nuevo: CSV a comparar.
+ * Returns:
+ *   - int: 0 si los valores objetivo coinciden, 1 si alguno difiere.
+ */
+int compararResultados(const string& base, const string& nuevo) {
+    auto corridasBase = leerCsv(base);
+    auto corridasNuevo = leerCsv(nuevo);
+    auto mediana = [](const vector<vector<string>>& corridas, int columna) {
+        vector<double> valores;
+        for (const auto& campos : corridas) {
+            valores.push_back(stod(campos[columna]));
+        }
+        sort(valores.begin(), valores.end());
+        return valores[valores.size() / 2];
+    };
+    const int VALOR = 4, TIEMPO = 5, NODOS = 6;
+
+    cout << fixed << setprecision(4);
+    cout << "instancia, tiempo base, tiempo nuevo, razón, nodos base, nodos nuevo\n";
+    double sumaLog = 0.0;
+    int comunes = 0;
+    bool distintos = false;
+    for (const auto& [instancia, corridas] : corridasBase) {
+        auto otra = corridasNuevo.find(instancia);
+        if (otra == corridasNuevo.end()) {
+            cout << instancia << ": solo en " << base << "\n";
+            continue;
+        }
+        double tiempoBase = mediana(corridas, TIEMPO);
+        double tiempoNuevo = mediana(otra->second, TIEMPO);
+        double razon = tiempoNuevo / max(1e-9, tiempoBase);
+        sumaLog += log(razon);
+        comunes++;
+        cout << instancia << ", " << tiempoBase << ", " << tiempoNuevo << ", " << razon << ", "
+             << (int)mediana(corridas, NODOS) << ", " << (int)mediana(otra->second, NODOS);
+        double valorBase = mediana(corridas, VALOR);
+        double valorNuevo = mediana(otra->second, VALOR);
+        if (abs(valorBase - valorNuevo) > 1e-6 * max(1.0, abs(valorBase))) {
+            cout << "  (valor distinto: " << valorBase << " vs " << valorNuevo << ")";
+            distintos = true;
+        }
+        cout << "\n";
+    }
+    for (const auto& [instancia, corridas] : corridasNuevo) {
+        if (!corridasBase.count(instancia)) {
+            cout << instancia << ": solo en " << nuevo << "\n";
+        }
+    }
+    if (comunes > 0) {
+        cout << "Media geométrica de la razón de tiempos (nuevo / base): " << exp(sumaLog / comunes) << " en " << comunes
+             << " instancias\n";
+    }
+    return distintos ? 1 : 0;
+}
+
+/**
+ * Desc: Muestra el uso del programa.
+ * Params:
+ *   - programa: Nombre del ejecutable.
+ * Returns: void
+ */
+void mostrarUso(const string& programa) {
+    cerr << "Uso: " << programa << " [opciones] instancia|directorio...\n"
+         << "     " << programa << " --comparar base.csv nuevo.csv\n"
+         << "Opciones:\n"
+         << "  --repeticiones N   Corridas por instancia (3)\n"
+         << "  --hilos K          Hilos del solver paralelo; 0 usa el secuencial (0)\n"
+         << "  --max-iter N       Máximo de nodos (100000)\n"
+         << "  --tol T            Tolerancia de optimalidad (1e-6)\n"
+         << "  --sin-reduccion    No reducir el problema antes de resolverlo\n"
+         << "  --benders          Usa la descomposición de Benders (ignora --hilos)\n"
+         << "  --csv archivo      Escribe una fila por corrida\n"
+         << "  --json archivo     Escribe un objeto por corrida\n";
+}
+
+/**
+ * Desc: Mide el solver sobre instancias o directorios de instancias, repitiendo cada
+ *       corrida en un proceso aparte, y compara dos reportes CSV.
+ *       Uso: bench [opciones] instancia|directorio...
+ *            bench --comparar base.csv nuevo.csv
+ */
+int main(int argc, char* argv[]) {
+    vector<string> argumentos(argv + 1, argv + argc);
+    if (argumentos.empty()) {
+        mostrarUso(argv[0]);
+        return 1;
+    }
+    try {
+        if (argumentos[0] == "--comparar") {
+            if (argumentos.size() != 3) {
+                mostrarUso(argv[0]);
+                return 1;
+            }
+            return compararResultados(argumentos[1], argumentos[2]);
+        }
+
+        OpcionesBench opciones;
+        for (size_t k = 0; k < argumentos.size(); k++) {
+            const string& arg = argumentos[k];
+            bool conValor = arg == "--repeticiones" || arg == "--hilos" || arg == "--max-iter" || arg == "--tol" ||
+                            arg == "--csv" || arg == "--json";
+            if (conValor && k + 1 >= argumentos.size()) {
+                cerr << "Error: Falta el valor de " << arg << "\n";
+                return 1;
+            }
+            if (arg == "--repeticiones") {
+                opciones.repeticiones = max(1, stoi(argumentos[++k]));
+            } else if (arg == "--hilos") {
+                opciones.hilos = max(0, stoi(argumentos[++k]));
+            } else if (arg == "--max-iter") {
+                opciones.maxIter = stoi(argumentos[++k]);
+            } else if (arg == "--tol") {
+                opciones.tolerancia = stod(argumentos[++k]);
+            } else if (arg == "--csv") {
+                opciones.archivoCsv = argumentos[++k];
+            } else if (arg == "--json") {
+                opciones.archivoJson = argumentos[++k];
+            } else if (arg == "--benders") {
+                opciones.benders = true;
+            } else if (arg == "--sin-reduccion") {
+                opciones.reduccion = false;
+            } else if (arg.rfind("--", 0) == 0) {
+                cerr << "Error: Opción desconocida " << arg << "\n";
+                mostrarUso(argv[0]);
+                return 1;
+            } else {
+                opciones.entradas.push_back(arg);
+            }
+        }
+        return ejecutarBench(opciones);
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+}
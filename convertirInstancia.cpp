@@ -0,0 +1,31 @@
+#include "Problema.h"
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/**
+ * Desc: Convierte una instancia CFL del formato de texto al formato binario,
+ *       que Problema carga proyectándolo en memoria.
+ *       Uso: convertirInstancia entrada.txt salida.cflb
+ */
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        cerr << "Uso: " << argv[0] << " entrada.txt salida.cflb\n";
+        return 1;
+    }
+    try {
+        Problema problema(argv[1]);
+        if (!problema.esValido()) {
+            cerr << "Error: El problema de " << argv[1] << " no es válido\n";
+            return 1;
+        }
+        problema.guardarBinario(argv[2]);
+        cout << "Instancia convertida: " << argv[1] << " -> " << argv[2] << " (" << problema.getNumFuentesProd()
+             << " fuentes, " << problema.getNumClientes() << " clientes)\n";
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "GeneradorInstancias.h"
+#include "Problema.h"
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/**
+ * Desc: Muestra el uso del programa.
+ * Params:
+ *   - programa: Nombre del ejecutable.
+ * Returns: void
+ */
+void mostrarUso(const string& programa) {
+    cerr << "Uso: " << programa << " [opciones] numFuentes numClientes salida(.txt|.cflb)\n"
+         << "Opciones:\n"
+         << "  --clase A|B|C   Razón capacidad / demanda 3, 5 o 10 (A)\n"
+         << "  --razon r       Razón capacidad / demanda, reemplaza la de la clase\n"
+         << "  --semilla s     Semilla del generador (1)\n";
+}
+
+/**
+ * Desc: Genera una instancia CFL aleatoria y la guarda en formato de texto, o en el
+ *       binario si la salida termina en .cflb.
+ *       Uso: generarInstancia [--clase A|B|C] [--razon r] [--semilla s] numFuentes numClientes salida
+ */
+int main(int argc, char* argv[]) {
+    ClaseInstancia clase = CLASE_A;
+    double razon = 0.0;
+    uint64_t semilla = 1;
+    vector<string> posicionales;
+    try {
+        for (int k = 1; k < argc; k++) {
+            string arg = argv[k];
+            if ((arg == "--clase" || arg == "--razon" || arg == "--semilla") && k + 1 >= argc) {
+                cerr << "Error: Falta el valor de " << arg << "\n";
+                return 1;
+            }
+            if (arg == "--clase") {
+                string valor = argv[++k];
+                if (valor != "A" && valor != "B" && valor != "C") {
+                    cerr << "Error: Clase desconocida " << valor << "\n";
+                    return 1;
+                }
+                clase = valor == "A" ? CLASE_A : valor == "B" ? CLASE_B : CLASE_C;
+            } else if (arg == "--razon") {
+                razon = stod(argv[++k]);
+            } else if (arg == "--semilla") {
+                semilla = stoull(argv[++k]);
+            } else if (arg.rfind("--", 0) == 0) {
+                cerr << "Error: Opción desconocida " << arg << "\n";
+                mostrarUso(argv[0]);
+                return 1;
+            } else {
+                posicionales.push_back(arg);
+            }
+        }
+        if (posicionales.size() != 3) {
+            mostrarUso(argv[0]);
+            return 1;
+        }
+        int numFuentes = stoi(posicionales[0]);
+        int numClientes = stoi(posicionales[1]);
+        const string& salida = posicionales[2];
+
+        GeneradorInstancias generador(semilla);
+        Problema problema = generador.generar(numFuentes, numClientes, clase, razon);
+        bool binario = salida.size() >= 5 && salida.compare(salida.size() - 5, 5, ".cflb") == 0;
+        if (binario) {
+            problema.guardarBinario(salida);
+        } else {
+            problema.guardarTexto(salida);
+        }
+        cout << "Instancia de " << numFuentes << " fuentes y " << numClientes << " clientes guardada en " << salida
+             << "\n";
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
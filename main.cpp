@@ -1,12 +1,54 @@
 #include "Problema.h"
 #include "ResolveCFL.h"
 #include "StrategyBranchAndBound.h"
+#include "StrategyBranchAndBoundParalelo.h"
+#include "StrategyBenders.h"
+#include "ResolvedorEscenarios.h"
 #include <iostream>
 #include <string>
 #include <memory>
 #include <fstream>
 #include <limits>
 #include <iomanip>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+// Caché de resultados del modo interactivo, para no resolver de nuevo un problema recargado
+const string DIRECTORIO_CACHE = "cache_cfl";
+
+// Códigos de salida del modo por lotes (con varios archivos, el peor de ellos)
+enum CodigoSalida {
+    SALIDA_OPTIMO = 0,      // óptimo probado
+    SALIDA_ERROR = 1,       // argumentos o archivo inválidos
+    SALIDA_INFACTIBLE = 2,  // infactibilidad probada
+    SALIDA_FACTIBLE = 3,    // se alcanzó un límite con una solución factible
+    SALIDA_LIMITE = 4       // se alcanzó un límite sin solución factible
+};
+
+struct OpcionesLote {
+    vector<string> archivos;
+    int maxIteraciones = 10000;
+    double tolerancia = 1e-6;
+    int numHilos = 1;           // hilos por problema
+    int numTrabajos = 0;        // problemas en paralelo; 0 = núcleos / hilos
+    double limiteTiempo = 0.0;  // segundos por problema; 0 = sin límite
+    double limiteMemoria = 0.0; // MB de nodos abiertos por problema; 0 = sin límite
+    string archivoSalida;
+    string directorioCache;     // caché de resultados; vacío = sin caché
+    string archivoEscenarios;   // demandas a resolver sobre el único archivo; vacío = sin escenarios
+    bool benders = false;       // descomposición de Benders en vez de ramificación y acotamiento
+    bool detallado = false;
+};
+
+struct ResultadoLote {
+    string archivo;
+    CodigoSalida codigo = SALIDA_ERROR;
+    ResultadoSolucion resultado;
+    string error;
+};
 
 void mostrarBanner() {
     cout << "\n";
@@ -44,6 +86,9 @@ void mostrarFormatoArchivo() {
     cout << "10 15\n";
     cout << "12 8\n";
     cout << "5 20\n";
+    cout << "\nTambién se acepta el formato binario generado por convertirInstancia\n";
+    cout << "(cabecera con m, n y desplazamientos, y arreglos de double contiguos),\n";
+    cout << "que se carga proyectándolo en memoria sin parsear.\n";
 }
 
 void crearArchivoEjemplo() {
@@ -69,6 +114,10 @@ void crearArchivoEjemplo() {
 }
 
 bool verificarArchivo(const string& nombreArchivo) {
+    // El formato binario se valida al cargarlo, contra su cabecera
+    if (Problema::esArchivoBinario(nombreArchivo)) {
+        return true;
+    }
     ifstream archivo(nombreArchivo);
     if (!archivo.is_open()) {
         cout << "Error: No se pudo abrir el archivo " << nombreArchivo << "\n";
@@ -97,7 +146,10 @@ void mostrarResultados(const ResultadoSolucion& resultado, const string& nombreS
         cout << fixed << setprecision(2);
         cout << "Valor objetivo: " << resultado.valorObjetivo << "\n";
         cout << "Número de iteraciones: " << resultado.numIteraciones << "\n";
-        cout << "Tiempo de ejecución: " << resultado.tiempoEjecucion << " segundos\n";
+        cout << "Tiempo de ejecución: " << resultado.tiempoEjecucion << " segundos"
+             << (resultado.desdeCache ? " (recuperado de la caché)" : "") << "\n";
+        cout << "Cota inferior: " << resultado.cotaInferior << " (brecha " << 100 * resultado.brecha << "%)\n";
+        cout << "Terminación: " << ResultadoSolucion::nombreMotivo(resultado.motivoTerminacion) << "\n";
         if (!resultado.solucionFinal.empty()) {
             cout << "\nSolución encontrada:\n";
             cout << "Fuentes activadas: ";
@@ -137,7 +189,309 @@ string leerNombreArchivo() {
     return nombreArchivo;
 }
 
-int main() {
+CodigoSalida clasificarResultado(const ResultadoSolucion& resultado) {
+    if (resultado.alcanzoLimite()) {
+        return resultado.esFactible ? SALIDA_FACTIBLE : SALIDA_LIMITE;
+    }
+    return resultado.motivoTerminacion == TERMINO_OPTIMO ? SALIDA_OPTIMO : SALIDA_INFACTIBLE;
+}
+
+string nombreCodigo(CodigoSalida codigo) {
+    switch (codigo) {
+        case SALIDA_OPTIMO:
+            return "optimo";
+        case SALIDA_INFACTIBLE:
+            return "infactible";
+        case SALIDA_FACTIBLE:
+            return "factible";
+        case SALIDA_LIMITE:
+            return "limite";
+        default:
+            return "error";
+    }
+}
+
+ResultadoLote resolverArchivo(const string& archivo, const OpcionesLote& opciones) {
+    ResultadoLote lote;
+    lote.archivo = archivo;
+    try {
+        Problema problema(archivo);
+        if (!problema.esValido()) {
+            throw runtime_error("el problema no es válido");
+        }
+        shared_ptr<StrategyResolucion> estrategia;
+        if (opciones.benders) {
+            auto benders = make_shared<StrategyBenders>(problema, opciones.maxIteraciones, opciones.tolerancia);
+            benders->setLimiteTiempo(opciones.limiteTiempo);
+            estrategia = benders;
+        } else {
+            shared_ptr<StrategyBranchAndBound> branchAndBound;
+            if (opciones.numHilos == 1) {
+                branchAndBound = make_shared<StrategyBranchAndBound>(problema, opciones.maxIteraciones, opciones.tolerancia);
+            } else {
+                branchAndBound = make_shared<StrategyBranchAndBoundParalelo>(problema, opciones.maxIteraciones,
+                                                                             opciones.tolerancia, opciones.numHilos);
+            }
+            branchAndBound->setLimiteTiempo(opciones.limiteTiempo);
+            branchAndBound->setLimiteMemoria(opciones.limiteMemoria);
+            estrategia = branchAndBound;
+        }
+        ResolveCFL resolvedor(estrategia);
+        if (!opciones.directorioCache.empty()) {
+            resolvedor.setCache(make_shared<CacheResultados>(opciones.directorioCache));
+        }
+        lote.resultado = resolvedor.resolver(problema);
+        lote.codigo = clasificarResultado(lote.resultado);
+    } catch (const exception& e) {
+        lote.codigo = SALIDA_ERROR;
+        lote.error = e.what();
+    }
+    return lote;
+}
+
+string cadenaJson(const string& texto) {
+    string escapado = "\"";
+    for (char c : texto) {
+        if (c == '"' || c == '\\') {
+            escapado += '\\';
+        }
+        escapado += c == '\n' ? ' ' : c;
+    }
+    return escapado + "\"";
+}
+
+bool escribirJson(const string& nombreArchivo, const vector<ResultadoLote>& resultados) {
+    ofstream archivo(nombreArchivo);
+    if (!archivo.is_open()) {
+        return false;
+    }
+    archivo << setprecision(12) << "[\n";
+    for (size_t k = 0; k < resultados.size(); k++) {
+        const ResultadoLote& lote = resultados[k];
+        const ResultadoSolucion& r = lote.resultado;
+        archivo << "  {\"archivo\": " << cadenaJson(lote.archivo) << ", \"estado\": \"" << nombreCodigo(lote.codigo)
+                << "\", \"codigo\": " << lote.codigo;
+        if (lote.codigo == SALIDA_ERROR) {
+            archivo << ", \"error\": " << cadenaJson(lote.error);
+        } else {
+            archivo << ", \"factible\": " << (r.esFactible ? "true" : "false");
+            if (r.esFactible) {
+                archivo << ", \"valor\": " << r.valorObjetivo;
+            }
+            if (r.cotaInferior < 1e20) {
+                archivo << ", \"cota_inferior\": " << r.cotaInferior;
+            }
+            if (r.esFactible) {
+                archivo << ", \"brecha\": " << r.brecha;
+            }
+            archivo << ", \"terminacion\": " << cadenaJson(ResultadoSolucion::nombreMotivo(r.motivoTerminacion));
+            archivo << ", \"nodos\": " << r.numIteraciones << ", \"tiempo_s\": " << r.tiempoEjecucion
+                    << ", \"cache\": " << (r.desdeCache ? "true" : "false") << ", \"fuentes_abiertas\": [";
+            bool primera = true;
+            for (size_t j = 0; j < r.solucionFinal.size(); j++) {
+                if (r.solucionFinal[j] > 0.5) {
+                    archivo << (primera ? "" : ", ") << j;
+                    primera = false;
+                }
+            }
+            archivo << "]";
+        }
+        archivo << "}" << (k + 1 < resultados.size() ? "," : "") << "\n";
+    }
+    archivo << "]\n";
+    return bool(archivo);
+}
+
+string lineaResumen(const ResultadoLote& lote) {
+    ostringstream linea;
+    linea << lote.archivo << ": " << nombreCodigo(lote.codigo);
+    if (lote.codigo == SALIDA_ERROR) {
+        linea << " (" << lote.error << ")";
+        return linea.str();
+    }
+    if (lote.resultado.esFactible) {
+        linea << fixed << setprecision(2) << ", valor " << lote.resultado.valorObjetivo;
+        if (lote.resultado.alcanzoLimite()) {
+            linea << ", brecha " << 100 * lote.resultado.brecha << "%";
+        }
+    }
+    if (lote.resultado.alcanzoLimite()) {
+        linea << " (" << ResultadoSolucion::nombreMotivo(lote.resultado.motivoTerminacion) << ")";
+    }
+    linea << ", " << lote.resultado.numIteraciones << " nodos, " << fixed << setprecision(2)
+          << lote.resultado.tiempoEjecucion << " s" << (lote.resultado.desdeCache ? " (caché)" : "");
+    return linea.str();
+}
+
+// Escenarios: cada vector de demandas del archivo sobre el único problema del lote, con un
+// solver secuencial por trabajo que pasa de un escenario al siguiente sin reconstruir su modelo.
+// Las líneas de resumen salen a medida que termina cada escenario.
+bool resolverEscenarios(const OpcionesLote& opciones, int numTrabajos, ostream& resumen,
+                        vector<ResultadoLote>& resultados) {
+    const string& archivo = opciones.archivos[0];
+    try {
+        Problema base(archivo);
+        if (!base.esValido()) {
+            throw runtime_error("el problema no es válido");
+        }
+        vector<vector<double>> demandas = ResolvedorEscenarios::leerEscenarios(opciones.archivoEscenarios,
+                                                                              base.getNumClientes());
+        ResolvedorEscenarios resolvedor(base, opciones.maxIteraciones, opciones.tolerancia, numTrabajos);
+        resolvedor.setLimiteTiempo(opciones.limiteTiempo);
+        resolvedor.setLimiteMemoria(opciones.limiteMemoria);
+        resultados.assign(demandas.size(), ResultadoLote());
+        resolvedor.resolver(demandas, [&](int k, const ResultadoSolucion& resultado) {
+            ResultadoLote& lote = resultados[k];
+            lote.archivo = archivo + "#" + to_string(k + 1);
+            lote.resultado = resultado;
+            lote.codigo = clasificarResultado(resultado);
+            resumen << lineaResumen(lote) << "\n" << flush;
+        });
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << "\n";
+        return false;
+    }
+    return true;
+}
+
+void mostrarUsoLote(const string& programa) {
+    cerr << "Uso: " << programa << " --solve archivo... [opciones]\n"
+         << "Opciones:\n"
+         << "  --max-iter N      Máximo de nodos por problema (10000)\n"
+         << "  --tol T           Tolerancia de optimalidad (1e-6)\n"
+         << "  --threads K       Hilos por problema; 1 usa el solver secuencial, 0 todos los núcleos (1)\n"
+         << "  --jobs J          Problemas resueltos a la vez (núcleos / hilos)\n"
+         << "  --time-limit S    Segundos por problema (sin límite)\n"
+         << "  --memory-limit MB Memoria de los nodos abiertos por problema (sin límite)\n"
+         << "  --output archivo  Resultados en JSON\n"
+         << "  --cache dir       Reutiliza y guarda resultados en el directorio (sin caché)\n"
+         << "  --scenarios arch  Resuelve cada vector de demandas del archivo (uno por línea) sobre el\n"
+         << "                    único archivo de --solve, un escenario por trabajo\n"
+         << "  --benders         Resuelve por descomposición de Benders (secuencial, sin límite de memoria;\n"
+         << "                    no se combina con --scenarios)\n"
+         << "  --verbose         Muestra el registro del solver\n"
+         << "Códigos de salida: 0 óptimo, 1 error, 2 infactible, 3 factible al alcanzar un límite,\n"
+         << "4 límite sin solución factible (con varios archivos, el peor).\n";
+}
+
+// Modo por lotes: resuelve los archivos sin preguntas, varios a la vez (un problema por
+// hilo), e imprime una línea por archivo. El registro del solver se descarta salvo con --verbose.
+int ejecutarLote(const vector<string>& argumentos, const string& programa) {
+    OpcionesLote opciones;
+    try {
+        bool leyendoArchivos = false;
+        for (size_t k = 0; k < argumentos.size(); k++) {
+            const string& arg = argumentos[k];
+            bool conValor = arg == "--max-iter" || arg == "--tol" || arg == "--threads" || arg == "--jobs" ||
+                            arg == "--time-limit" || arg == "--memory-limit" || arg == "--output" ||
+                            arg == "--cache" || arg == "--scenarios";
+            if (conValor && k + 1 >= argumentos.size()) {
+                cerr << "Error: Falta el valor de " << arg << "\n";
+                return SALIDA_ERROR;
+            }
+            if (arg == "--solve") {
+                leyendoArchivos = true;
+                continue;
+            }
+            if (arg == "--max-iter") {
+                opciones.maxIteraciones = stoi(argumentos[++k]);
+            } else if (arg == "--tol") {
+                opciones.tolerancia = stod(argumentos[++k]);
+            } else if (arg == "--threads") {
+                opciones.numHilos = max(0, stoi(argumentos[++k]));
+            } else if (arg == "--jobs") {
+                opciones.numTrabajos = max(0, stoi(argumentos[++k]));
+            } else if (arg == "--time-limit") {
+                opciones.limiteTiempo = stod(argumentos[++k]);
+            } else if (arg == "--memory-limit") {
+                opciones.limiteMemoria = stod(argumentos[++k]);
+            } else if (arg == "--output") {
+                opciones.archivoSalida = argumentos[++k];
+            } else if (arg == "--cache") {
+                opciones.directorioCache = argumentos[++k];
+            } else if (arg == "--scenarios") {
+                opciones.archivoEscenarios = argumentos[++k];
+            } else if (arg == "--benders") {
+                opciones.benders = true;
+            } else if (arg == "--verbose") {
+                opciones.detallado = true;
+            } else if (arg.rfind("--", 0) == 0 || !leyendoArchivos) {
+                cerr << "Error: Argumento inesperado " << arg << "\n";
+                mostrarUsoLote(programa);
+                return SALIDA_ERROR;
+            } else {
+                opciones.archivos.push_back(arg);
+            }
+        }
+    } catch (const exception& e) {
+        cerr << "Error: Valor inválido (" << e.what() << ")\n";
+        return SALIDA_ERROR;
+    }
+    bool escenariosValidos = opciones.archivos.size() == 1 && !opciones.benders;
+    if (opciones.archivos.empty() || (!opciones.archivoEscenarios.empty() && !escenariosValidos)) {
+        mostrarUsoLote(programa);
+        return SALIDA_ERROR;
+    }
+
+    int nucleos = max(1u, thread::hardware_concurrency());
+    int hilosPorProblema = opciones.numHilos == 0 ? nucleos : opciones.numHilos;
+    int numTrabajos = opciones.numTrabajos > 0 ? opciones.numTrabajos : max(1, nucleos / hilosPorProblema);
+
+    // El solver escribe su registro en cout; las líneas de resumen van directo al stdout
+    ostream resumen(cout.rdbuf());
+    if (!opciones.detallado) {
+        cout.setstate(ios::badbit);
+    }
+
+    vector<ResultadoLote> resultados(opciones.archivos.size());
+    if (!opciones.archivoEscenarios.empty()) {
+        bool resuelto = resolverEscenarios(opciones, opciones.numTrabajos > 0 ? opciones.numTrabajos : nucleos, resumen,
+                                           resultados);
+        cout.clear();
+        if (!resuelto) {
+            return SALIDA_ERROR;
+        }
+    } else {
+        numTrabajos = min(numTrabajos, (int)opciones.archivos.size());
+        atomic<size_t> siguiente(0);
+        mutex mtxResumen;
+        auto trabajador = [&]() {
+            size_t k;
+            while ((k = siguiente++) < opciones.archivos.size()) {
+                resultados[k] = resolverArchivo(opciones.archivos[k], opciones);
+                string linea = lineaResumen(resultados[k]);
+                lock_guard<mutex> lock(mtxResumen);
+                resumen << linea << "\n" << flush;
+            }
+        };
+        vector<thread> hilos;
+        for (int h = 0; h < numTrabajos; h++) {
+            hilos.emplace_back(trabajador);
+        }
+        for (auto& hilo : hilos) {
+            hilo.join();
+        }
+        cout.clear();
+    }
+
+    if (!opciones.archivoSalida.empty() && !escribirJson(opciones.archivoSalida, resultados)) {
+        cerr << "Error: No se pudo escribir " << opciones.archivoSalida << "\n";
+        return SALIDA_ERROR;
+    }
+    int codigo = SALIDA_OPTIMO;
+    for (const ResultadoLote& lote : resultados) {
+        if (lote.codigo == SALIDA_ERROR) {
+            return SALIDA_ERROR;
+        }
+        codigo = max(codigo, (int)lote.codigo);
+    }
+    return codigo;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return ejecutarLote(vector<string>(argv + 1, argv + argc), argv[0]);
+    }
     mostrarBanner();
     shared_ptr<Problema> problemaActual = nullptr;
     string nombreArchivoActual = "";
@@ -205,6 +559,12 @@ int main() {
 
                     int maxIteraciones = 10000;
                     double tolerancia = 1e-6;
+                    int numHilos = 1;
+                    PoliticaSeleccion politica = MEJOR_PRIMERO;
+                    ModoAcotamiento modo = COTA_LP;
+                    TipoRamificacion rama = RAMA_MAS_FRACCIONARIA;
+                    bool cortes = true;
+                    bool benders = false;
 
                     cout << "¿Desea cambiar los parámetros? (s/n): ";
                     char respuesta;
@@ -221,10 +581,50 @@ int main() {
                         if (cin >> nuevaTol && nuevaTol > 0) {
                             tolerancia = nuevaTol;
                         }
+                        cout << "Número de hilos (0 = todos los núcleos) [" << numHilos << "]: ";
+                        int nuevosHilos;
+                        if (cin >> nuevosHilos && nuevosHilos >= 0) {
+                            numHilos = nuevosHilos;
+                        }
+                        cout << "Selección de nodos (0 = mejor cota, 1 = profundidad, 2 = mejor estimación) [" << politica << "]: ";
+                        int nuevaPolitica;
+                        if (cin >> nuevaPolitica && nuevaPolitica >= 0 && nuevaPolitica <= 2) {
+                            politica = static_cast<PoliticaSeleccion>(nuevaPolitica);
+                        }
+                        cout << "Cota de los nodos (0 = relajación LP, 1 = relajación Lagrangeana) [" << modo << "]: ";
+                        int nuevoModo;
+                        if (cin >> nuevoModo && nuevoModo >= 0 && nuevoModo <= 1) {
+                            modo = static_cast<ModoAcotamiento>(nuevoModo);
+                        }
+                        cout << "Regla de ramificación (0 = más fraccionaria, 1 = fuerte, 2 = pseudo-costos, 3 = confiabilidad) ["
+                             << rama << "]: ";
+                        int nuevaRama;
+                        if (cin >> nuevaRama && nuevaRama >= 0 && nuevaRama <= 3) {
+                            rama = static_cast<TipoRamificacion>(nuevaRama);
+                        }
+                        cout << "Cortes en la raíz (0 = no, 1 = sí) [" << cortes << "]: ";
+                        int nuevosCortes;
+                        if (cin >> nuevosCortes && nuevosCortes >= 0 && nuevosCortes <= 1) {
+                            cortes = nuevosCortes == 1;
+                        }
+                        // Benders solo usa las iteraciones y la tolerancia de lo anterior
+                        cout << "Estrategia (0 = Branch and Bound, 1 = descomposición de Benders) [" << benders << "]: ";
+                        int nuevaEstrategia;
+                        if (cin >> nuevaEstrategia && nuevaEstrategia >= 0 && nuevaEstrategia <= 1) {
+                            benders = nuevaEstrategia == 1;
+                        }
                     }
 
-                    auto estrategia = make_shared<StrategyBranchAndBound>(*problemaActual, maxIteraciones, tolerancia);
+                    shared_ptr<StrategyResolucion> estrategia;
+                    if (benders) {
+                        estrategia = make_shared<StrategyBenders>(*problemaActual, maxIteraciones, tolerancia);
+                    } else if (numHilos == 1) {
+                        estrategia = make_shared<StrategyBranchAndBound>(*problemaActual, maxIteraciones, tolerancia, politica, modo, rama, cortes);
+                    } else {
+                        estrategia = make_shared<StrategyBranchAndBoundParalelo>(*problemaActual, maxIteraciones, tolerancia, numHilos, politica, modo, rama, cortes);
+                    }
                     ResolveCFL resolvedor(estrategia);
+                    resolvedor.setCache(make_shared<CacheResultados>(DIRECTORIO_CACHE));
                     cout << "\nEjecutando algoritmo...\n";
                     ResultadoSolucion resultado = resolvedor.resolver(*problemaActual);
                     mostrarResultados(resultado, resolvedor.getNombreStrategy());
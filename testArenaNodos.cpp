@@ -0,0 +1,57 @@
+#include "NodoCompacto.h"
+#include "ArenaNodos.h"
+#include "AlmacenBases.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para ArenaNodos, NodoCompacto y AlmacenBases.
+ *       Verifica la herencia de variables fijadas, la reutilización de memoria
+ *       y el redondeo hacia abajo de la cota en precisión simple.
+ */
+
+int main() {
+    cout << "=== Iniciando testArenaNodos ===\n";
+
+    // === 1. Crear raíz e hijos con variables fijadas ===
+    ArenaNodos arena(100, 16);
+    NodoCompacto* raiz = arena.crear();
+    raiz->fijarVariable(3, 1);
+    raiz->fijarVariable(70, 0);
+
+    NodoCompacto* hijo = arena.crearHijo(raiz);
+    hijo->fijarVariable(70, 1);
+    cout << "[testArenaNodos] Bytes por nodo (100 variables): " << arena.bytesPorNodo() << "\n";
+    cout << "[testArenaNodos] Hijo - Profundidad: " << hijo->profundidad << ", Fijadas: " << hijo->numFijadas()
+         << " (esperado 1, 2)\n";
+    cout << "[testArenaNodos] y3 fijada? " << (hijo->estaFijada(3) ? "Sí" : "No")
+         << ", y4 fijada? " << (hijo->estaFijada(4) ? "Sí" : "No") << "\n";
+
+    // === 2. Reutilización de nodos liberados ===
+    arena.liberar(hijo);
+    NodoCompacto* reutilizado = arena.crear();
+    cout << "[testArenaNodos] Reutiliza la memoria liberada? " << (reutilizado == hijo ? "Sí" : "No")
+         << ", Nodos vivos: " << arena.nodosVivos() << " (esperado 2)\n";
+
+    // === 3. Cota en precisión simple nunca mayor que la real ===
+    double cota = 1234567.891;
+    raiz->establecerCotaInferior(cota);
+    cout << "[testArenaNodos] Cota guardada <= cota real? " << (raiz->cotaInferior <= cota ? "Sí" : "No") << "\n";
+
+    // === 4. Almacén de bases ===
+    AlmacenBases bases(5, 2);
+    unsigned char base[5] = {1, 3, 3, 1, 2};
+    vector<int> indices;
+    for (int k = 0; k < 3; k++) {
+        indices.push_back(bases.guardar(base));
+    }
+    bases.liberar(indices[1]);
+    int idx = bases.guardar(base);
+    cout << "[testArenaNodos] Base reutilizada: " << idx << " (esperado " << indices[1] << "), vivas: "
+         << bases.basesVivas() << ", primer estado: " << int(bases.obtener(idx)[0]) << "\n";
+
+    cout << "=== testArenaNodos finalizado ===\n";
+    return 0;
+}
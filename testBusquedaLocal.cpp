@@ -0,0 +1,52 @@
+#include "BusquedaLocal.h"
+#include "EvaluadorTransporte.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para la búsqueda local de abrir/cerrar/intercambiar.
+ *       Verifica que llegue al óptimo de instancias pequeñas (comparado con la
+ *       enumeración de todas las combinaciones) y que nunca empeore una solución.
+ */
+
+int main() {
+    cout << "=== Iniciando testBusquedaLocal ===\n";
+    for (string nombre : {"facil1.txt", "facil2.txt", "facil3.txt"}) {
+        Problema p(nombre);
+        int m = p.getNumFuentesProd();
+        EvaluadorTransporte evaluador;
+        evaluador.construir(p);
+
+        // === 1. Óptimo por enumeración ===
+        double optimo = 1e20;
+        for (int mascara = 1; mascara < (1 << m); mascara++) {
+            vector<double> y(m);
+            for (int j = 0; j < m; j++) {
+                y[j] = (mascara >> j) & 1;
+            }
+            optimo = min(optimo, evaluador.evaluar(y));
+        }
+
+        // === 2. Búsqueda local desde todas las fuentes abiertas ===
+        BusquedaLocal busqueda;
+        busqueda.construir(p);
+        vector<double> solucion(m, 1.0);
+        double costoInicial = evaluador.evaluar(solucion);
+        double costo = costoInicial;
+        busqueda.mejorar(solucion, costo, evaluador);
+        cout << "[testBusquedaLocal] " << nombre << " - Inicial: " << costoInicial << ", búsqueda local: " << costo
+             << " (" << busqueda.obtenerMovimientosAceptados() << " movimientos), óptimo: " << optimo << "\n";
+        cout << "[testBusquedaLocal] Costo coincide con el evaluador? "
+             << (evaluador.evaluar(solucion) == costo ? "Sí" : "No") << "\n";
+
+        // === 3. Desde el óptimo no debe moverse ===
+        double costoOptimo = costo;
+        bool mejoro = busqueda.mejorar(solucion, costoOptimo, evaluador);
+        cout << "[testBusquedaLocal] Mejora un mínimo local? " << (mejoro ? "Sí" : "No") << " (esperado No)\n";
+    }
+    cout << "=== Fin testBusquedaLocal ===\n";
+    return 0;
+}
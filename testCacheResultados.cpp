@@ -0,0 +1,76 @@
+#include "CacheResultados.h"
+#include "Problema.h"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para la huella de Problema y la caché de resultados.
+ *       Verifica que la huella no dependa del formato del archivo, que una
+ *       entrada guardada se recupere igual y que otra huella, otros parámetros
+ *       o una entrada dañada no se confundan con ella.
+ */
+
+int main() {
+    cout << "=== Iniciando testCacheResultados ===\n";
+    const string directorio = "cache_test";
+    filesystem::remove_all(directorio);
+
+    // === 1. Huella del problema ===
+    Problema texto("problema_test.txt");
+    texto.guardarBinario("problema_test.cflb");
+    Problema binario("problema_test.cflb");
+    Problema copia = texto;
+    copia.prohibirArco(0, 0);
+    vector<double> demandas = texto.getDemandas();
+    demandas[0] += 1;
+    vector<double> costos(texto.getMatrizCostos().begin(), texto.getMatrizCostos().end());
+    vector<double> activacion;
+    for (int j = 0; j < texto.getNumFuentesProd(); j++) {
+        activacion.push_back(texto.getCostoActivacion(j));
+    }
+    Problema otraDemanda(texto.getCapacidades(), activacion, demandas, costos);
+    Problema reconstruido(texto.getCapacidades(), activacion, texto.getDemandas(), costos);
+    cout << "[testCacheResultados] Texto = binario: " << (texto.calcularHuella() == binario.calcularHuella())
+         << ", texto = reconstruido: " << (texto.calcularHuella() == reconstruido.calcularHuella())
+         << " (esperado 1, 1)\n";
+    cout << "[testCacheResultados] Con arco prohibido: " << (texto.calcularHuella() == copia.calcularHuella())
+         << ", con otra demanda: " << (texto.calcularHuella() == otraDemanda.calcularHuella()) << " (esperado 0, 0)\n";
+
+    // === 2. Guardar y recuperar ===
+    CacheResultados cache(directorio);
+    ResultadoSolucion resultado;
+    resultado.valorObjetivo = 1234.5;
+    resultado.solucionFinal = {1.0, 0.0, 1.0};
+    resultado.esFactible = true;
+    resultado.numIteraciones = 17;
+    resultado.cotaInferior = 1234.5;
+    resultado.actualizarBrecha();
+    ResultadoSolucion leido;
+    uint64_t huella = texto.calcularHuella();
+    cout << "[testCacheResultados] Antes de guardar: " << cache.buscar(huella, "bb iter=10", leido)
+         << " (esperado 0)\n";
+    cache.guardar(huella, "bb iter=10", resultado);
+    bool encontrado = cache.buscar(huella, "bb iter=10", leido);
+    cout << "[testCacheResultados] Recuperado: " << encontrado << ", valor " << leido.valorObjetivo << ", "
+         << leido.numIteraciones << " nodos, " << leido.solucionFinal.size() << " fuentes, brecha " << leido.brecha
+         << " (esperado 1, 1234.5, 17, 3, 0)\n";
+
+    // === 3. Sin coincidencia ===
+    cout << "[testCacheResultados] Otros parámetros: " << cache.buscar(huella, "bb iter=20", leido)
+         << ", otra huella: " << cache.buscar(huella + 1, "bb iter=10", leido) << " (esperado 0, 0)\n";
+
+    // === 4. Entrada dañada ===
+    for (const auto& entrada : filesystem::directory_iterator(directorio)) {
+        filesystem::resize_file(entrada.path(), 10);
+    }
+    cout << "[testCacheResultados] Entrada truncada: " << cache.buscar(huella, "bb iter=10", leido)
+         << " (esperado 0)\n";
+
+    filesystem::remove_all(directorio);
+    filesystem::remove("problema_test.cflb");
+    cout << "=== Fin testCacheResultados ===\n";
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "EvaluadorTransporte.h"
+#include "Problema.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Crea un archivo de prueba con datos predefinidos para cargar un problema CFL.
+ *       Contiene 2 fuentes, 3 clientes y datos de capacidades, costos y demandas.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo a crear.
+ * Returns: void
+ */
+void crearArchivoPrueba(const string& nombreArchivo) {
+    ofstream archivo(nombreArchivo);
+    // 2 fuentes, 3 clientes
+    archivo << "2 3\n"; 
+    // Capacidades de fuentes
+    archivo << "100 200\n"; 
+    // Costos de activación
+    archivo << "10 20\n"; 
+    // Demandas de clientes
+    archivo << "50 60 70\n"; 
+    // Matriz de costos de transporte (3x2)
+    archivo << "5 6\n";   // Cliente 0: costos para fuente 0 y 1
+    archivo << "7 8\n";   // Cliente 1: costos para fuente 0 y 1
+    archivo << "9 10\n";  // Cliente 2: costos para fuente 0 y 1
+    archivo.close();
+}
+
+int main() {
+    // === 1. Cargar problema y construir el grafo una vez ===
+    string archivo = "problema_test.txt";
+    crearArchivoPrueba(archivo);
+    Problema p(archivo);
+
+    EvaluadorTransporte evaluador;
+    evaluador.construir(p);
+    cout << "=== Test EvaluadorTransporte ===\n";
+
+    // === 2. Evaluar distintas combinaciones de fuentes abiertas sobre el mismo grafo ===
+    cout << "Ambas abiertas: " << evaluador.evaluar({1, 1}) << " (esperado 1410)\n";
+    cout << "Flujos: ";
+    for (int i = 0; i < p.getNumClientes(); i++) {
+        for (int j = 0; j < p.getNumFuentesProd(); j++) {
+            cout << "x" << i << j << "=" << evaluador.obtenerFlujo(i, j) << " ";
+        }
+    }
+    cout << "\n";
+    cout << "Solo fuente 1: " << evaluador.evaluar({0, 1}) << " (esperado 1500)\n";
+    cout << "Solo fuente 0: " << evaluador.evaluar({1, 0}) << " (esperado 1e+20, capacidad insuficiente)\n";
+
+    // === 3. Instancia del repositorio con asignación no trivial ===
+    Problema facil("facil1.txt");
+    EvaluadorTransporte evaluadorFacil;
+    evaluadorFacil.construir(facil);
+    cout << "facil1 ambas abiertas: " << evaluadorFacil.evaluar({1, 1}) << " (esperado 420)\n";
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "GeneradorInstancias.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+#include <cstdio>
+
+using namespace std;
+
+/**
+ * Desc: Compara dos problemas dato a dato.
+ * Params:
+ *   - a: Primer problema.
+ *   - b: Segundo problema.
+ * Returns:
+ *   - bool: True si tienen las mismas dimensiones y los mismos datos.
+ */
+bool mismosDatos(const Problema& a, const Problema& b) {
+    if (a.getNumFuentesProd() != b.getNumFuentesProd() || a.getNumClientes() != b.getNumClientes()) {
+        return false;
+    }
+    if (a.getCapacidades() != b.getCapacidades() || a.getDemandas() != b.getDemandas()) {
+        return false;
+    }
+    for (int j = 0; j < a.getNumFuentesProd(); j++) {
+        if (a.getCostoActivacion(j) != b.getCostoActivacion(j)) {
+            return false;
+        }
+    }
+    VistaCostos ca = a.getMatrizCostos();
+    VistaCostos cb = b.getMatrizCostos();
+    for (size_t k = 0; k < ca.size(); k++) {
+        if (ca[k] != cb[k]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Desc: Test unitario para el generador de instancias.
+ *       Verifica que la semilla determine la instancia, que se respete la razón
+ *       capacidad / demanda de cada clase y que los formatos de texto y binario
+ *       relean exactamente los mismos datos.
+ */
+
+int main() {
+    cout << "=== Iniciando testGeneradorInstancias ===\n";
+
+    // === 1. Misma semilla, misma instancia ===
+    Problema p1 = GeneradorInstancias(42).generar(20, 50, CLASE_A);
+    Problema p2 = GeneradorInstancias(42).generar(20, 50, CLASE_A);
+    Problema p3 = GeneradorInstancias(43).generar(20, 50, CLASE_A);
+    cout << "[testGeneradorInstancias] Tamaño: " << p1.getNumFuentesProd() << "x" << p1.getNumClientes()
+         << " (esperado 20x50), válido? " << (p1.esValido() ? "Sí" : "No") << " (esperado Sí)\n";
+    cout << "[testGeneradorInstancias] Semilla 42 dos veces iguales? " << (mismosDatos(p1, p2) ? "Sí" : "No")
+         << " (esperado Sí), semilla 43 igual? " << (mismosDatos(p1, p3) ? "Sí" : "No") << " (esperado No)\n";
+
+    // === 2. Razón capacidad / demanda ===
+    for (ClaseInstancia clase : {CLASE_A, CLASE_B, CLASE_C}) {
+        Problema p = GeneradorInstancias(7).generar(30, 100, clase);
+        double capacidad = 0.0, demanda = 0.0;
+        for (double M : p.getCapacidades()) {
+            capacidad += M;
+        }
+        for (double d : p.getDemandas()) {
+            demanda += d;
+        }
+        cout << "[testGeneradorInstancias] Clase " << char('A' + clase) << ": razón " << capacidad / demanda
+             << " (esperado apenas sobre " << GeneradorInstancias::razonClase(clase) << ")\n";
+    }
+    Problema ajustada = GeneradorInstancias(7).generar(30, 100, CLASE_A, 1.5);
+    double capacidad = 0.0, demanda = 0.0;
+    for (double M : ajustada.getCapacidades()) {
+        capacidad += M;
+    }
+    for (double d : ajustada.getDemandas()) {
+        demanda += d;
+    }
+    cout << "[testGeneradorInstancias] Razón pedida 1.5: " << capacidad / demanda << " (esperado apenas sobre 1.5)\n";
+
+    // === 3. Ida y vuelta por ambos formatos ===
+    p1.guardarTexto("generada_test.txt");
+    p1.guardarBinario("generada_test.cflb");
+    Problema texto("generada_test.txt");
+    Problema binario("generada_test.cflb");
+    cout << "[testGeneradorInstancias] Texto releído igual? " << (mismosDatos(p1, texto) ? "Sí" : "No")
+         << " (esperado Sí), binario releído igual? " << (mismosDatos(p1, binario) ? "Sí" : "No") << " (esperado Sí)\n";
+    remove("generada_test.txt");
+    remove("generada_test.cflb");
+
+    // === 4. Dimensiones inválidas ===
+    try {
+        GeneradorInstancias().generar(0, 10, CLASE_A);
+        cout << "[testGeneradorInstancias] Dimensión 0 aceptada (esperado error)\n";
+    } catch (const runtime_error& e) {
+        cout << "[testGeneradorInstancias] Dimensión 0 rechazada: " << e.what() << "\n";
+    }
+
+    cout << "=== Fin testGeneradorInstancias ===\n";
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "HeuristicaRedondeo.h"
+#include "HeuristicaBuceo.h"
+#include "HeuristicaRINS.h"
+#include "ArenaNodos.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para las heurísticas primales guiadas por el LP.
+ *       Desde la raíz de instancias pequeñas, compara lo que encuentra cada
+ *       heurística con el óptimo por enumeración y revisa sus estadísticas.
+ */
+
+int main() {
+    cout << "=== Iniciando testHeuristicaPrimal ===\n";
+    for (string nombre : {"facil1.txt", "facil3.txt", "med1.txt"}) {
+        Problema p(nombre);
+        int m = p.getNumFuentesProd();
+        EvaluadorTransporte evaluador;
+        evaluador.construir(p);
+
+        // === 1. Óptimo por enumeración y una solución mala como incumbente ===
+        double optimo = 1e20;
+        if (m <= 16) {
+            for (int mascara = 1; mascara < (1 << m); mascara++) {
+                vector<double> y(m);
+                for (int j = 0; j < m; j++) {
+                    y[j] = (mascara >> j) & 1;
+                }
+                optimo = min(optimo, evaluador.evaluar(y));
+            }
+        }
+        vector<double> incumbente(m, 1.0);
+        double costoIncumbente = evaluador.evaluar(incumbente);
+
+        // === 2. Relajación de la raíz ===
+        ModeloRelajacionLP modelo;
+        modelo.construir(p);
+        ArenaNodos arena(m);
+        NodoCompacto* raiz = arena.crear();
+        modelo.resolver(*raiz, nullptr);
+        vector<double> y = modelo.obtenerSolucionY();
+        cout << "[testHeuristicaPrimal] " << nombre << " - Cota LP: " << modelo.obtenerValorObjetivo()
+             << ", incumbente: " << costoIncumbente << ", óptimo: " << (optimo < 1e20 ? to_string(optimo) : "?") << "\n";
+
+        // === 3. Cada heurística desde la raíz ===
+        HeuristicaRedondeo redondeo;
+        HeuristicaBuceo buceo;
+        HeuristicaRINS rins;
+        for (HeuristicaPrimal* heuristica : {(HeuristicaPrimal*)&redondeo, (HeuristicaPrimal*)&buceo, (HeuristicaPrimal*)&rins}) {
+            ContextoHeuristica contexto{&p, &modelo, &evaluador, raiz, &y, &incumbente, costoIncumbente, 1e-6, {}};
+            vector<double> solucion;
+            double costo;
+            bool mejora = heuristica->ejecutar(contexto, solucion, costo);
+            cout << "[testHeuristicaPrimal]   " << heuristica->getNombre() << ": " << (costo < 1e20 ? to_string(costo) : "sin solución")
+                 << (mejora ? " (mejora)" : "") << ", costo coincide con el evaluador? "
+                 << (costo >= 1e20 || evaluador.evaluar(solucion) == costo ? "Sí" : "No") << ", no baja del óptimo? "
+                 << (costo >= optimo - 1e-6 ? "Sí" : "No") << "\n";
+            cout << "[testHeuristicaPrimal]   Llamadas: " << heuristica->obtenerLlamadas() << " (esperado 1), éxitos: "
+                 << heuristica->obtenerExitos() << ", mejoras: " << heuristica->obtenerMejoras() << "\n";
+        }
+
+        // === 4. Frecuencia ===
+        buceo.setFrecuencia(10);
+        cout << "[testHeuristicaPrimal] Buceo en nodos 0, 5, 10: " << buceo.debeEjecutarse(0) << buceo.debeEjecutarse(5)
+             << buceo.debeEjecutarse(10) << " (esperado 101)\n";
+    }
+    cout << "=== Fin testHeuristicaPrimal ===\n";
+    return 0;
+}
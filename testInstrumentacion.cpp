@@ -0,0 +1,64 @@
+#define INSTRUMENTACION
+#include "Instrumentacion.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para la instrumentación del solver (compilado con
+ *       INSTRUMENTACION definido). Verifica el temporizador por fase, los
+ *       contadores desde varios hilos y los intervalos del histograma.
+ */
+
+int main() {
+    cout << "=== Iniciando testInstrumentacion ===\n";
+    Instrumentacion instrumentacion;
+
+    // === 1. Temporizador RAII ===
+    {
+        MEDIR_FASE(instrumentacion, FASE_COLA);
+        this_thread::sleep_for(chrono::milliseconds(20));
+    }
+    EstadisticasResolucion e = instrumentacion.obtenerEstadisticas();
+    cout << "[testInstrumentacion] Fase cola: " << e.segundosFase[FASE_COLA] << " s (esperado ~0.02), relajación: "
+         << e.segundosFase[FASE_RELAJACION] << " (esperado 0)\n";
+
+    // === 2. Contadores desde varios hilos ===
+    vector<thread> hilos;
+    for (int h = 0; h < 4; h++) {
+        hilos.emplace_back([&instrumentacion]() {
+            for (int k = 0; k < 1000; k++) {
+                CONTAR_INSTRUMENTACION(instrumentacion, contarCreado());
+            }
+            CONTAR_INSTRUMENTACION(instrumentacion, contarPodadoPorCota(10));
+        });
+    }
+    for (auto& hilo : hilos) {
+        hilo.join();
+    }
+    e = instrumentacion.obtenerEstadisticas();
+    cout << "[testInstrumentacion] Creados: " << e.nodosCreados << " (esperado 4000), podados por cota: "
+         << e.podadosPorCota << " (esperado 40)\n";
+
+    // === 3. Histograma de iteraciones LP ===
+    for (int iteraciones : {0, 1, 2, 3, 4, 7, 8, 1000000}) {
+        instrumentacion.registrarIteracionesLP(iteraciones);
+    }
+    e = instrumentacion.obtenerEstadisticas();
+    cout << "[testInstrumentacion] Intervalos [0] " << e.histogramaIteracionesLP[0] << ", [1] "
+         << e.histogramaIteracionesLP[1] << ", [2-3] " << e.histogramaIteracionesLP[2] << ", [4-7] "
+         << e.histogramaIteracionesLP[3] << ", [8-15] " << e.histogramaIteracionesLP[4] << ", último "
+         << e.histogramaIteracionesLP[NUM_INTERVALOS_ITERACIONES - 1] << " (esperado 1, 1, 2, 2, 1, 1)\n";
+    e.imprimir();
+
+    // === 4. Reinicio ===
+    instrumentacion.reiniciar();
+    e = instrumentacion.obtenerEstadisticas();
+    cout << "[testInstrumentacion] Tras reiniciar: " << e.nodosCreados << " creados, " << e.segundosFase[FASE_COLA]
+         << " s (esperado 0, 0)\n";
+
+    cout << "=== Fin testInstrumentacion ===\n";
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "ModeloRelajacionLP.h"
+#include "Problema.h"
+#include <iostream>
+#include <fstream>
+
+using namespace std;
+
+/**
+ * Desc: Crea un archivo de prueba con datos predefinidos para cargar un problema CFL.
+ *       Contiene 2 fuentes, 3 clientes y datos de capacidades, costos y demandas.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo a crear.
+ * Returns: void
+ */
+void crearArchivoPrueba(const string& nombreArchivo) {
+    ofstream archivo(nombreArchivo);
+    // 2 fuentes, 3 clientes
+    archivo << "2 3\n"; 
+    // Capacidades de fuentes
+    archivo << "100 200\n"; 
+    // Costos de activación
+    archivo << "10 20\n"; 
+    // Demandas de clientes
+    archivo << "50 60 70\n"; 
+    // Matriz de costos de transporte (3x2)
+    archivo << "5 6\n";   // Cliente 0: costos para fuente 0 y 1
+    archivo << "7 8\n";   // Cliente 1: costos para fuente 0 y 1
+    archivo << "9 10\n";  // Cliente 2: costos para fuente 0 y 1
+    archivo.close();
+}
+
+int main() {
+    // === 1. Crear archivo de prueba y construir el modelo una vez ===
+    string archivo = "problema_test.txt";
+    crearArchivoPrueba(archivo);
+    Problema p(archivo);
+
+    ModeloRelajacionLP modelo;
+    modelo.construir(p);
+    cout << "=== Test ModeloRelajacionLP ===\n";
+    cout << "Modelo construido? " << (modelo.estaConstruido() ? "Sí" : "No") << "\n";
+
+    // === 2. Resolver la raíz en frío ===
+    map<int, int> fijadas;
+    bool factible = modelo.resolver(fijadas, vector<unsigned char>());
+    cout << "Raíz factible? " << (factible ? "Sí" : "No") << "\n";
+    cout << "Cota raíz: " << modelo.obtenerValorObjetivo() << " (iteraciones: " << modelo.obtenerIteraciones() << ")\n";
+    vector<unsigned char> baseRaiz = modelo.obtenerBase();
+
+    // === 3. Re-resolver hijos desde la base de la raíz ===
+    for (int valor : {0, 1}) {
+        fijadas[1] = valor;
+        factible = modelo.resolver(fijadas, baseRaiz);
+        cout << "Hijo y1=" << valor << " factible? " << (factible ? "Sí" : "No");
+        if (factible) {
+            cout << ", cota: " << modelo.obtenerValorObjetivo();
+        }
+        cout << " (iteraciones: " << modelo.obtenerIteraciones() << ")\n";
+    }
+
+    // === 4. Mostrar solución y del último solve ===
+    cout << "Solución y: ";
+    for (double y : modelo.obtenerSolucionY()) {
+        cout << y << " ";
+    }
+    cout << "\n";
+
+    // === 5. Costos reducidos de la raíz: moverlas a la otra cota no baja la cota ===
+    modelo.resolver(map<int, int>(), baseRaiz);
+    double cotaRaiz = modelo.obtenerValorObjetivo();
+    vector<double> yRaiz = modelo.obtenerSolucionY();
+    vector<double> reducidos(modelo.obtenerCostosReducidosY(), modelo.obtenerCostosReducidosY() + yRaiz.size());
+    for (int j = 0; j < (int)yRaiz.size(); j++) {
+        if (yRaiz[j] > 1e-9 && yRaiz[j] < 1.0 - 1e-9) {
+            continue;
+        }
+        int otro = yRaiz[j] <= 1e-9 ? 1 : 0;
+        factible = modelo.resolver({{j, otro}}, baseRaiz);
+        cout << "y" << j << "=" << otro << ": cota " << (factible ? to_string(modelo.obtenerValorObjetivo()) : "infactible")
+             << " >= raíz + |costo reducido| = " << cotaRaiz + abs(reducidos[j]) << "\n";
+    }
+
+    // === 6. Matriz CSC compartida: tamaño exacto y misma cota que con la matriz propia ===
+    EstructuraLP estructura;
+    estructura.preparar(p);
+    int n = p.getNumClientes();
+    int m = p.getNumFuentesProd();
+    cout << "Elementos de la matriz: " << estructura.filas.size() << " (esperado " << 2 * n * m + m << ")\n";
+    ModeloRelajacionLP compartido;
+    compartido.construir(p, estructura);
+    compartido.resolver(map<int, int>(), vector<unsigned char>());
+    cout << "Cota raíz con la matriz compartida: " << compartido.obtenerValorObjetivo() << " (esperado " << cotaRaiz
+         << ")\n";
+    Problema med("med1.txt");
+    estructura.preparar(med);
+    ModeloRelajacionLP modeloMed;
+    ModeloRelajacionLP modeloMedPropio;
+    modeloMed.construir(med, estructura);
+    modeloMedPropio.construir(med);
+    modeloMed.resolver(map<int, int>(), vector<unsigned char>());
+    modeloMedPropio.resolver(map<int, int>(), vector<unsigned char>());
+    cout << "med1 tras reutilizar la estructura: " << modeloMed.obtenerValorObjetivo() << " (esperado "
+         << modeloMedPropio.obtenerValorObjetivo() << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "NodoCompacto.h"
+#include "ArenaNodos.h"
+#include "ComparadorNodos.h"
+#include "PoolNodos.h"
+#include <iostream>
+#include <vector>
+#include <memory>
+
+using namespace std;
+
+ArenaNodos arena(10);
+
+/**
+ * Desc: Crea un nodo con la cota, profundidad y estimación dadas.
+ * Params:
+ *   - cota: Cota inferior del nodo.
+ *   - prof: Profundidad del nodo.
+ *   - est: Estimación del costo entero.
+ * Returns:
+ *   - NodoCompacto*: Nodo creado en la arena.
+ */
+NodoCompacto* crearNodo(double cota, int prof, double est) {
+    NodoCompacto* nodo = arena.crear();
+    nodo->establecerCotaInferior(cota);
+    nodo->profundidad = prof;
+    nodo->estimacion = est;
+    return nodo;
+}
+
+/**
+ * Desc: Inserta los mismos nodos en un pool con la política dada y
+ *       muestra el orden en que el trabajador 0 los extrae.
+ * Params:
+ *   - politica: Política de selección a probar.
+ *   - nombre: Nombre de la política para la salida.
+ * Returns: void
+ */
+void probarPolitica(PoliticaSeleccion politica, const string& nombre) {
+    PoolNodos pool(1, politica);
+    pool.insertar(0, crearNodo(150.0, 1, 400.0));
+    pool.insertar(0, crearNodo(100.0, 2, 300.0));
+    pool.insertar(0, crearNodo(200.0, 3, 250.0));
+    pool.insertar(0, crearNodo(120.0, 1, 350.0));
+
+    cout << "[testPoolNodos] " << nombre << " - Tamaño: " << pool.tamano()
+         << ", Mejor cota: " << pool.mejorCotaInferior() << "\n";
+    cout << "[testPoolNodos] Orden (cota/profundidad/estimación): ";
+    while (auto nodo = pool.extraer(0)) {
+        cout << nodo->cotaInferior << "/" << nodo->profundidad << "/" << nodo->estimacion << " ";
+        arena.liberar(nodo);
+    }
+    cout << "\n";
+}
+
+int main() {
+    cout << "=== Iniciando testPoolNodos ===\n";
+
+    // === 1. Orden de extracción con cada política ===
+    probarPolitica(MEJOR_PRIMERO, "Mejor primero (esperado 100 120 150 200)");
+    probarPolitica(PROFUNDIDAD_PRIMERO, "Profundidad primero (esperado LIFO: 120 200 100 150)");
+    probarPolitica(MEJOR_ESTIMACION, "Mejor estimación");
+
+    // === 2. Robo entre trabajadores ===
+    PoolNodos pool(2, PROFUNDIDAD_PRIMERO);
+    pool.insertar(1, crearNodo(10.0, 1, 0.0));
+    pool.insertar(1, crearNodo(20.0, 2, 0.0));
+    auto robado = pool.extraer(0);
+    cout << "[testPoolNodos] Trabajador 0 roba el nodo más antiguo del 1 - Cota: "
+         << (robado ? robado->cotaInferior : -1) << " (esperado 10)\n";
+
+    // === 3. Poda por cota superior ===
+    pool.insertar(0, crearNodo(50.0, 3, 0.0));
+    vector<NodoCompacto*> podados = pool.podar(30.0);
+    cout << "[testPoolNodos] Tras podar con cota 30 - Tamaño: " << pool.tamano() << " (esperado 1), podados: " << podados.size() << "\n";
+
+    cout << "=== testPoolNodos finalizado ===\n";
+    return 0;
+}
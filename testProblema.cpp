@@ -51,5 +51,76 @@ int main() {
     cout << "\n== Imprimir problema ==\n";
     p.imprimir();
 
+    // === 6. Vistas contiguas de la matriz de costos ===
+    cout << "\nFila del cliente 1: ";
+    for (double c : p.getCostosCliente(1)) {
+        cout << c << " ";
+    }
+    cout << "(esperado 7 8)\n";
+    cout << "Columna de la fuente 1: ";
+    for (double c : p.getCostosFuente(1)) {
+        cout << c << " ";
+    }
+    cout << "(esperado 6 8 10)\n";
+    cout << "Matriz alineada a 64 bytes? "
+         << (reinterpret_cast<uintptr_t>(p.getMatrizCostos().begin()) % 64 == 0 ? "Sí" : "No") << "\n";
+
+    // === 7. Formato binario: guardar y volver a cargar con mmap ===
+    string archivoBinario = "problema_test.cflb";
+    p.guardarBinario(archivoBinario);
+    cout << "\nEs binario? texto: " << (Problema::esArchivoBinario(archivo) ? "Sí" : "No")
+         << ", binario: " << (Problema::esArchivoBinario(archivoBinario) ? "Sí" : "No") << " (esperado No, Sí)\n";
+    Problema pb(archivoBinario);
+    bool iguales = pb.getNumClientes() == p.getNumClientes() && pb.getNumFuentesProd() == p.getNumFuentesProd();
+    for (int j = 0; iguales && j < p.getNumFuentesProd(); j++) {
+        iguales = pb.getCapacidad(j) == p.getCapacidad(j) && pb.getCostoActivacion(j) == p.getCostoActivacion(j);
+    }
+    for (int i = 0; iguales && i < p.getNumClientes(); i++) {
+        iguales = pb.getDemanda(i) == p.getDemanda(i);
+        for (int j = 0; iguales && j < p.getNumFuentesProd(); j++) {
+            iguales = pb.getCostoEnvio(i, j) == p.getCostoEnvio(i, j);
+        }
+    }
+    cout << "Binario igual al texto? " << (iguales ? "Sí" : "No") << "\n";
+
+    // === 8. Una copia sigue viendo los costos después de destruir el original ===
+    Problema* original = new Problema(archivoBinario);
+    Problema copia = *original;
+    delete original;
+    cout << "Costo envío cliente 2 a fuente 1 en la copia: " << copia.getCostoEnvio(2, 1) << " (esperado 10)\n";
+    cout << "Columna de la fuente 0 en la copia: " << copia.getCostosFuente(0)[2] << " (esperado 9)\n";
+
+    // === 9. Cambio de demandas y costos de activación sobre una copia ===
+    Problema modificado = p;
+    CambioProblema cambio;
+    cambio.demandas = {{0, 55}};
+    cambio.costosActivacion = {{1, 25}};
+    modificado.aplicarCambio(cambio);
+    cout << "Demanda cliente 0: " << modificado.getDemanda(0) << " (esperado 55), en el original: " << p.getDemanda(0)
+         << "\n";
+    cout << "Costo activación fuente 1: " << modificado.getCostoActivacion(1) << " (esperado 25), matriz compartida? "
+         << (modificado.getMatrizCostos().datos == p.getMatrizCostos().datos ? "Sí" : "No") << "\n";
+    try {
+        CambioProblema invalido;
+        invalido.demandas = {{p.getNumClientes(), 1}};
+        modificado.aplicarCambio(invalido);
+        cout << "Sin error para un cliente fuera de rango (se esperaba uno)\n";
+    } catch (const exception& e) {
+        cout << "Error esperado: " << e.what() << "\n";
+    }
+
+    // === 10. Archivos mal formados: error con línea y columna ===
+    auto probarError = [](const string& nombre, const string& contenido) {
+        ofstream(nombre) << contenido;
+        try {
+            Problema malo(nombre);
+            cout << "Sin error para " << nombre << " (se esperaba uno)\n";
+        } catch (const exception& e) {
+            cout << "Error esperado: " << e.what() << "\n";
+        }
+    };
+    probarError("problema_truncado.txt", "2 3\n100 200\n10 20\n50 60 70\n5 6\n7 8\n9\n");
+    probarError("problema_malformado.txt", "2 3\n100 200\n10 2x\n50 60 70\n5 6\n7 8\n9 10\n");
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "ReduccionProblema.h"
+#include "EvaluadorTransporte.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Óptimo de un problema pequeño enumerando todas las combinaciones de fuentes.
+ * Params:
+ *   - p: Problema con pocas fuentes.
+ *   - mejor: Salida con la mejor combinación.
+ * Returns:
+ *   - double: Costo óptimo (1e20 si es infactible).
+ */
+double optimoPorEnumeracion(const Problema& p, vector<double>& mejor) {
+    int m = p.getNumFuentesProd();
+    EvaluadorTransporte evaluador;
+    evaluador.construir(p);
+    double optimo = 1e20;
+    for (int mascara = 1; mascara < (1 << m); mascara++) {
+        vector<double> y(m);
+        for (int j = 0; j < m; j++) {
+            y[j] = (mascara >> j) & 1;
+        }
+        double costo = evaluador.evaluar(y);
+        if (costo < optimo) {
+            optimo = costo;
+            mejor = y;
+        }
+    }
+    return optimo;
+}
+
+/**
+ * Desc: Test unitario para la reducción del problema (presolve y postsolve).
+ *       Verifica que cada regla se aplique en una instancia armada para ello y que
+ *       el óptimo del problema reducido, llevado al original, sea el mismo.
+ */
+
+int main() {
+    cout << "=== Iniciando testReduccionProblema ===\n";
+
+    // === 1. Instancia armada (D = 180): la fuente 1 está dominada por la 0, que cubre D;
+    //        sin la 1, la 0 es obligada y el cliente 3 no tiene demanda ===
+    vector<double> capacidades = {200, 150, 100};
+    vector<double> activacion = {10, 30, 40};
+    vector<double> demandas = {50, 60, 70, 0};
+    vector<double> costos = {1, 2, 5,
+                             3, 3, 1,
+                             4, 6, 2,
+                             9, 9, 9};
+    Problema armado(capacidades, activacion, demandas, costos);
+    ReduccionProblema reduccion;
+    Problema reducido = reduccion.reducir(armado);
+    reduccion.imprimirResumen();
+    cout << "[testReduccionProblema] Fuentes: " << reducido.getNumFuentesProd() << " (esperado 2), clientes: "
+         << reducido.getNumClientes() << " (esperado 3), capacidad de la fuente 0: " << reducido.getCapacidad(0)
+         << " (esperado 180)\n";
+    cout << "[testReduccionProblema] Dominadas: " << reduccion.obtenerDominadas() << " (esperado 1), obligadas: "
+         << reduccion.obtenerFijadasAbiertas() << " (esperado 1), arcos prohibidos: " << reduccion.obtenerArcosProhibidos()
+         << " (esperado 1), activación de la obligada: " << reducido.getCostoActivacion(0) << " (esperado 0)\n";
+
+    vector<double> mejorOriginal, mejorReducida;
+    double optimoOriginal = optimoPorEnumeracion(armado, mejorOriginal);
+    double optimoReducido = reduccion.recuperarCosto(optimoPorEnumeracion(reducido, mejorReducida));
+    vector<double> recuperada = reduccion.recuperarSolucion(mejorReducida);
+    EvaluadorTransporte evaluador;
+    evaluador.construir(armado);
+    cout << "[testReduccionProblema] Óptimo original: " << optimoOriginal << ", reducido llevado al original: "
+         << optimoReducido << ", costo de la solución recuperada: " << evaluador.evaluar(recuperada) << "\n";
+
+    // === 2. Instancias de prueba: el óptimo no cambia (enumeración solo con pocas fuentes) ===
+    for (string nombre : {"facil1.txt", "facil2.txt", "facil3.txt"}) {
+        Problema p(nombre);
+        if (p.getNumFuentesProd() > 12) {
+            continue;
+        }
+        ReduccionProblema r;
+        Problema q = r.reducir(p);
+        double original = optimoPorEnumeracion(p, mejorOriginal);
+        double reducidoRecuperado = r.recuperarCosto(optimoPorEnumeracion(q, mejorReducida));
+        cout << "[testReduccionProblema] " << nombre << " - Fuentes " << p.getNumFuentesProd() << " -> "
+             << q.getNumFuentesProd() << ", óptimo " << original << " vs " << reducidoRecuperado << " ("
+             << (abs(original - reducidoRecuperado) < 1e-6 ? "coinciden" : "DISTINTOS") << ")\n";
+    }
+
+    // === 3. med1 (16 fuentes) contra su óptimo conocido, obtenido una vez por enumeración:
+    //        todas las fuentes abiertas, costo 4368646571.465 ===
+    Problema med("med1.txt");
+    ReduccionProblema reduccionMed;
+    Problema medReducido = reduccionMed.reducir(med);
+    vector<double> todasAbiertas(med.getNumFuentesProd(), 1.0);
+    EvaluadorTransporte evaluadorMed;
+    evaluadorMed.construir(med);
+    EvaluadorTransporte evaluadorMedReducido;
+    evaluadorMedReducido.construir(medReducido);
+    double costoMed = evaluadorMed.evaluar(todasAbiertas);
+    double costoMedReducido = reduccionMed.recuperarCosto(
+        evaluadorMedReducido.evaluar(vector<double>(medReducido.getNumFuentesProd(), 1.0)));
+    cout << "[testReduccionProblema] med1.txt - Fuentes " << med.getNumFuentesProd() << " -> "
+         << medReducido.getNumFuentesProd() << " (esperado 16 -> 16), óptimo " << costoMed << " vs "
+         << costoMedReducido << " (esperado 4.36865e+09, "
+         << (abs(costoMed - 4368646571.465) < 1e-2 && abs(costoMedReducido - costoMed) < 1e-6 ? "coinciden" : "DISTINTOS")
+         << ")\n";
+
+    cout << "=== Fin testReduccionProblema ===\n";
+    return 0;
+}
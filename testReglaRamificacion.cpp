@@ -0,0 +1,76 @@
+#include "ReglaRamificacion.h"
+#include "RamificacionFuerte.h"
+#include "RamificacionPseudoCosto.h"
+#include "RamificacionConfiabilidad.h"
+#include "ModeloRelajacionLP.h"
+#include "ArenaNodos.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para las reglas de ramificación.
+ *       Verifica la elección de la más fraccionaria, el aprendizaje de pseudo-costos
+ *       y que las reglas que resuelven ramas tentativas dejen el modelo intacto.
+ */
+
+int main() {
+    cout << "=== Iniciando testReglaRamificacion ===\n";
+    ModeloRelajacionLP modelo;
+    vector<double> valoresY = {0.0, 0.3, 1.0, 0.55, 0.9};
+
+    // === 1. Regla por defecto ===
+    ReglaRamificacion masFraccionaria;
+    cout << "[testReglaRamificacion] Más fraccionaria: y" << masFraccionaria.elegirVariable(modelo, valoresY, nullptr, 0.0)
+         << " (esperado y3)\n";
+    cout << "[testReglaRamificacion] Solución entera: "
+         << masFraccionaria.elegirVariable(modelo, {0.0, 1.0, 1.0}, nullptr, 0.0) << " (esperado -1)\n";
+
+    // === 2. Pseudo-costos aprendidos de ramas observadas ===
+    RamificacionPseudoCosto pseudoCosto;
+    // y1 = 0.3: la rama a 0 sube 3 (10 por unidad), la rama a 1 sube 14 (20 por unidad)
+    pseudoCosto.registrarRama(1, 0, 0.3, 100.0, 103.0);
+    pseudoCosto.registrarRama(1, 1, 0.3, 100.0, 114.0);
+    // y3 = 0.5: casi no mueve la cota en ninguna rama
+    pseudoCosto.registrarRama(3, 0, 0.5, 100.0, 100.1);
+    pseudoCosto.registrarRama(3, 1, 0.5, 100.0, 100.1);
+    cout << "[testReglaRamificacion] Pseudo-costos y1: " << pseudoCosto.obtenerPseudoCosto(1, 0) << " / "
+         << pseudoCosto.obtenerPseudoCosto(1, 1) << " (esperado 10 / 20), observaciones: "
+         << pseudoCosto.obtenerObservaciones(1, 0) << "\n";
+    cout << "[testReglaRamificacion] Pseudo-costos elige: y"
+         << pseudoCosto.elegirVariable(modelo, {0.0, 0.3, 1.0, 0.55, 1.0}, nullptr, 0.0) << " (esperado y1)\n";
+
+    // === 3. Ramificación fuerte y por confiabilidad sobre un LP real ===
+    Problema p("facil3.txt");
+    modelo.construir(p);
+    ArenaNodos arena(p.getNumFuentesProd());
+    NodoCompacto* raiz = arena.crear();
+    modelo.resolver(*raiz, nullptr);
+    double cota = modelo.obtenerValorObjetivo();
+    vector<double> y = modelo.obtenerSolucionY();
+    vector<unsigned char> base = modelo.obtenerBase();
+    cout << "[testReglaRamificacion] Raíz facil3 - Cota: " << cota << ", y: ";
+    for (double v : y) {
+        cout << v << " ";
+    }
+    cout << "\n";
+
+    RamificacionFuerte fuerte;
+    int varFuerte = fuerte.elegirVariable(modelo, y, base.data(), cota);
+    RamificacionConfiabilidad confiabilidad;
+    int varConfiable = confiabilidad.elegirVariable(modelo, y, base.data(), cota);
+    cout << "[testReglaRamificacion] Fuerte elige: y" << varFuerte << ", Confiabilidad elige: y" << varConfiable << "\n";
+    if (varConfiable >= 0) {
+        cout << "[testReglaRamificacion] Confiabilidad aprendió y" << varConfiable << ": "
+             << confiabilidad.obtenerObservaciones(varConfiable, 0) << " / "
+             << confiabilidad.obtenerObservaciones(varConfiable, 1) << " observaciones (esperado 1 / 1)\n";
+    }
+
+    modelo.resolver(*raiz, base.data());
+    cout << "[testReglaRamificacion] Cota tras las pruebas: " << modelo.obtenerValorObjetivo() << " (esperado " << cota << ")\n";
+
+    cout << "=== Fin testReglaRamificacion ===\n";
+    return 0;
+}
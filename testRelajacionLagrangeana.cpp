@@ -0,0 +1,86 @@
+#include "RelajacionLagrangeana.h"
+#include "EvaluadorTransporte.h"
+#include "ArenaNodos.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para RelajacionLagrangeana.
+ *       Compara la cota de la raíz con el óptimo por enumeración en instancias pequeñas,
+ *       verifica que los hijos partan de los multiplicadores del padre y que un nodo
+ *       sin capacidad suficiente se declare infactible.
+ */
+
+/**
+ * Desc: Calcula el óptimo enumerando todas las combinaciones de fuentes abiertas.
+ * Params:
+ *   - p: Problema a resolver (pocas fuentes).
+ * Returns:
+ *   - double: Costo óptimo.
+ */
+double optimoPorEnumeracion(const Problema& p) {
+    EvaluadorTransporte evaluador;
+    evaluador.construir(p);
+    int m = p.getNumFuentesProd();
+    double mejor = 1e20;
+    for (int mascara = 1; mascara < (1 << m); mascara++) {
+        vector<double> y(m);
+        for (int j = 0; j < m; j++) {
+            y[j] = (mascara >> j) & 1;
+        }
+        mejor = min(mejor, evaluador.evaluar(y));
+    }
+    return mejor;
+}
+
+int main() {
+    cout << "=== Iniciando testRelajacionLagrangeana ===\n";
+
+    // === 1. Cota de la raíz frente al óptimo ===
+    for (string archivo : {"facil1.txt", "facil2.txt", "facil3.txt"}) {
+        Problema p(archivo);
+        RelajacionLagrangeana relajacion;
+        relajacion.construir(p);
+        ArenaNodos arena(p.getNumFuentesProd());
+        NodoCompacto* raiz = arena.crear();
+        relajacion.resolver(*raiz, nullptr, 1e20);
+        double optimo = optimoPorEnumeracion(p);
+        cout << "[testRelajacionLagrangeana] " << archivo << " - Cota: " << relajacion.obtenerValorObjetivo()
+             << ", Óptimo: " << optimo << ", Iteraciones: " << relajacion.obtenerIteraciones()
+             << ", Cota válida? " << (relajacion.obtenerValorObjetivo() <= optimo + 1e-6 ? "Sí" : "No") << "\n";
+    }
+
+    // === 2. Hijo que hereda los multiplicadores del padre ===
+    Problema p("facil3.txt");
+    RelajacionLagrangeana relajacion(300, 20);
+    relajacion.construir(p);
+    ArenaNodos arena(p.getNumFuentesProd());
+    NodoCompacto* raiz = arena.crear();
+    relajacion.resolver(*raiz, nullptr, 1e20);
+    double cotaRaiz = relajacion.obtenerValorObjetivo();
+    int var = relajacion.elegirVariable(*raiz);
+    vector<double> multiplicadores(relajacion.obtenerMultiplicadores(),
+                                   relajacion.obtenerMultiplicadores() + p.getNumClientes());
+
+    NodoCompacto* hijo = arena.crearHijo(raiz);
+    hijo->fijarVariable(var, 1);
+    relajacion.resolver(*hijo, reinterpret_cast<const unsigned char*>(multiplicadores.data()), 1e20);
+    cout << "[testRelajacionLagrangeana] Ramifica en y" << var << " - Cota hijo (y" << var << "=1): "
+         << relajacion.obtenerValorObjetivo() << ", Iteraciones: " << relajacion.obtenerIteraciones()
+         << " (a lo más 20), Cota raíz: " << cotaRaiz << "\n";
+
+    // === 3. Nodo sin capacidad para cubrir la demanda ===
+    NodoCompacto* cerrado = arena.crear();
+    for (int j = 0; j < p.getNumFuentesProd(); j++) {
+        cerrado->fijarVariable(j, 0);
+    }
+    cout << "[testRelajacionLagrangeana] Todas cerradas factible? "
+         << (relajacion.resolver(*cerrado, nullptr, 1e20) ? "Sí" : "No") << " (esperado No)\n";
+
+    cout << "=== Fin testRelajacionLagrangeana ===\n";
+    return 0;
+}
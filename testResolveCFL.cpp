@@ -60,5 +60,26 @@ int main() {
     }
     cout << "\n";
 
+    // Reoptimizar tras subir una demanda y bajar un costo de activación, y comparar
+    // con una resolución desde cero del mismo problema modificado
+    CambioProblema cambio;
+    cambio.demandas = {{0, 80}};
+    cambio.costosActivacion = {{1, 5}};
+    auto reoptimizado = solver.reoptimizar(cambio);
+    Problema modificado = p;
+    modificado.aplicarCambio(cambio);
+    ResolveCFL solverFrio(make_shared<StrategyBranchAndBound>(modificado, 1000, 1e-6));
+    auto frio = solverFrio.resolver(modificado);
+    cout << "\n=== Reoptimización ===\n";
+    cout << "Valor reoptimizado: " << reoptimizado.valorObjetivo << ", desde cero: " << frio.valorObjetivo
+         << " (esperado iguales)\n";
+
+    // Solo costos de activación: la cota anterior sigue valiendo
+    CambioProblema soloCostos;
+    soloCostos.costosActivacion = {{0, 12}};
+    auto soloCostosResultado = solver.reoptimizar(soloCostos);
+    cout << "Valor tras cambiar solo costos: " << soloCostosResultado.valorObjetivo << ", nodos "
+         << soloCostosResultado.numIteraciones << ", brecha " << soloCostosResultado.brecha << " (esperado brecha 0)\n";
+
     return 0;
 }
\ No newline at end of file
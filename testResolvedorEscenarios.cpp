@@ -0,0 +1,70 @@
+#include "ResolvedorEscenarios.h"
+#include "StrategyBranchAndBound.h"
+#include "Problema.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+int main() {
+    // === 1. Cargar una instancia mediana y armar escenarios de demanda ===
+    Problema p("med1.txt");
+    cout << "=== Test ResolvedorEscenarios ===\n";
+    vector<vector<double>> demandas;
+    for (double factor : {1.0, 0.9, 1.1, 0.8, 1.2, 1.05}) {
+        vector<double> escenario = p.getDemandas();
+        for (int i = 0; i < p.getNumClientes(); i++) {
+            escenario[i] *= i % 2 == 0 ? factor : 1.0;
+        }
+        demandas.push_back(escenario);
+    }
+
+    // === 2. Resolver los escenarios en lote, con dos hilos ===
+    ResolvedorEscenarios resolvedor(p, 10000, 1e-6, 2);
+    vector<ResultadoSolucion> resultados(demandas.size());
+    int entregados = 0;
+    resolvedor.resolver(demandas, [&](int k, const ResultadoSolucion& resultado) {
+        resultados[k] = resultado;
+        entregados++;
+        cout << "Escenario " << k + 1 << " terminado - Valor objetivo: " << resultado.valorObjetivo << "\n";
+    });
+    cout << "Escenarios entregados: " << entregados << " (esperado " << demandas.size() << ")\n";
+
+    // === 3. Comparar cada escenario con una resolución independiente desde cero ===
+    bool coinciden = true;
+    for (size_t k = 0; k < demandas.size(); k++) {
+        Problema escenario = p;
+        CambioProblema cambio;
+        for (int i = 0; i < p.getNumClientes(); i++) {
+            cambio.demandas.emplace_back(i, demandas[k][i]);
+        }
+        escenario.aplicarCambio(cambio);
+        StrategyBranchAndBound estrategia(escenario, 10000, 1e-6);
+        ResultadoSolucion referencia = estrategia.resolver(escenario);
+        coinciden = coinciden && referencia.esFactible == resultados[k].esFactible &&
+                    abs(referencia.valorObjetivo - resultados[k].valorObjetivo) <= 1e-6 * max(1.0, referencia.valorObjetivo);
+    }
+    cout << "Coinciden con las resoluciones independientes? " << (coinciden ? "Sí" : "No") << " (esperado Sí)\n";
+
+    // === 4. Archivo de escenarios y escenario inválido ===
+    {
+        ofstream archivo("escenarios_test.txt");
+        for (const auto& escenario : demandas) {
+            for (int i = 0; i < p.getNumClientes(); i++) {
+                archivo << escenario[i] << (i + 1 < p.getNumClientes() ? ' ' : '\n');
+            }
+        }
+    }
+    auto leidos = ResolvedorEscenarios::leerEscenarios("escenarios_test.txt", p.getNumClientes());
+    cout << "Escenarios leídos: " << leidos.size() << " (esperado " << demandas.size() << ")\n";
+    remove("escenarios_test.txt");
+    try {
+        resolvedor.resolver({vector<double>(p.getNumClientes() - 1, 1.0)}, [](int, const ResultadoSolucion&) {});
+        cout << "Sin error para un escenario incompleto (se esperaba uno)\n";
+    } catch (const exception& e) {
+        cout << "Error esperado: " << e.what() << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include "SeparadorCortes.h"
+#include "ModeloRelajacionLP.h"
+#include "PoolCortes.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Desc: Test unitario para la separación de cortes en la raíz.
+ *       Verifica que el pool guarde los cortes, que la cota de la raíz no baje al
+ *       agregarlos y que otro modelo cargado con el mismo pool dé la misma cota.
+ */
+
+int main() {
+    cout << "=== Iniciando testSeparadorCortes ===\n";
+
+    // === 1. Pool de cortes ===
+    PoolCortes pool;
+    pool.agregar(CORTE_COTA_VARIABLE, {0, 6}, {1.0, -50.0}, -COIN_DBL_MAX, 0.0);
+    pool.agregar(CORTE_COBERTURA, {6, 7}, {1.0, 1.0}, 1.0, COIN_DBL_MAX);
+    cout << "[testSeparadorCortes] Cortes: " << pool.numCortes() << " (esperado 2), cobertura: "
+         << pool.contar(CORTE_COBERTURA) << " (esperado 1), inicio del segundo: " << pool.obtenerInicios()[1]
+         << " (esperado 2)\n";
+    pool.vaciar();
+    cout << "[testSeparadorCortes] Tras vaciar: " << pool.numCortes() << " (esperado 0)\n";
+
+    // === 2. Separación en la raíz de facil3 ===
+    Problema p("facil3.txt");
+    ModeloRelajacionLP modelo;
+    modelo.construir(p);
+    SeparadorCortes separador;
+    separador.construir(p);
+    bool factible = separador.separarRaiz(modelo, pool);
+    cout << "[testSeparadorCortes] Raíz factible? " << (factible ? "Sí" : "No") << "\n";
+    cout << "[testSeparadorCortes] Cota sin cortes: " << separador.obtenerCotaInicial()
+         << ", con cortes: " << separador.obtenerCotaFinal() << " (no debe bajar)\n";
+    cout << "[testSeparadorCortes] Cortes: " << pool.numCortes() << " en " << separador.obtenerRondas() << " rondas (cota variable "
+         << pool.contar(CORTE_COTA_VARIABLE) << ", cobertura " << pool.contar(CORTE_COBERTURA) << ", cobertura de flujo "
+         << pool.contar(CORTE_COBERTURA_FLUJO) << ")\n";
+
+    // === 3. Otro modelo con el mismo pool (como un hilo trabajador) ===
+    ModeloRelajacionLP copia;
+    copia.construir(p);
+    copia.agregarCortes(pool);
+    copia.resolver(map<int, int>(), vector<unsigned char>());
+    cout << "[testSeparadorCortes] Cota del modelo con el pool: " << copia.obtenerValorObjetivo() << " (esperado "
+         << separador.obtenerCotaFinal() << "), tamaño de base: " << copia.tamanoBase() << " (esperado "
+         << modelo.tamanoBase() << ")\n";
+
+    cout << "=== Fin testSeparadorCortes ===\n";
+    return 0;
+}
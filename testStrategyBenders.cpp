@@ -0,0 +1,92 @@
+#include "StrategyBenders.h"
+#include "StrategyBranchAndBound.h"
+#include "ResolveCFL.h"
+#include "GeneradorInstancias.h"
+#include "Problema.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <memory>
+
+using namespace std;
+
+/**
+ * Desc: Crea un archivo de prueba con datos predefinidos para cargar un problema CFL.
+ *       Contiene 2 fuentes, 3 clientes y datos de capacidades, costos y demandas.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo a crear.
+ * Returns: void
+ */
+void crearArchivoPrueba(const string& nombreArchivo) {
+    ofstream archivo(nombreArchivo);
+    archivo << "2 3\n";
+    archivo << "100 200\n";
+    archivo << "10 20\n";
+    archivo << "50 60 70\n";
+    archivo << "5 6\n";
+    archivo << "7 8\n";
+    archivo << "9 10\n";
+    archivo.close();
+}
+
+/**
+ * Desc: Resuelve una instancia con Benders y con ramificación y acotamiento e imprime
+ *       los dos valores, que deben coincidir, con los tiempos de cada uno.
+ * Params:
+ *   - nombre: Nombre a mostrar.
+ *   - problema: Instancia a resolver.
+ * Returns: void
+ */
+void compararEstrategias(const string& nombre, const Problema& problema) {
+    StrategyBenders benders(problema, 100000, 1e-6);
+    ResultadoSolucion resultadoBenders = benders.resolver(problema);
+    StrategyBranchAndBound branchAndBound(problema, 100000, 1e-6);
+    ResultadoSolucion resultadoBB = branchAndBound.resolver(problema);
+    cout << nombre << ": Benders " << resultadoBenders.valorObjetivo << " ("
+         << ResultadoSolucion::nombreMotivo(resultadoBenders.motivoTerminacion) << ", "
+         << resultadoBenders.tiempoEjecucion << " s, " << benders.getCortesOptimalidad() << " cortes) (esperado "
+         << resultadoBB.valorObjetivo << ", B&B " << resultadoBB.tiempoEjecucion << " s)\n";
+}
+
+int main() {
+    // === 1. Instancia chica con capacidades activas ===
+    string archivo = "problema_test.txt";
+    crearArchivoPrueba(archivo);
+    Problema p(archivo);
+    cout << "=== Test StrategyBenders ===\n";
+    StrategyBenders strategy(p, 1000, 1e-6);
+    ResultadoSolucion resultado = strategy.resolver(p);
+    cout << "Valor objetivo: " << resultado.valorObjetivo << " (esperado 1410)\n";
+    cout << "Solución final: ";
+    for (double x : resultado.solucionFinal) {
+        cout << x << " ";
+    }
+    cout << "(esperado 1 1)\n";
+    cout << "Motivo: " << ResultadoSolucion::nombreMotivo(resultado.motivoTerminacion) << " (esperado óptimo)\n";
+
+    // === 2. Mismo óptimo que ramificación y acotamiento, con y sin capacidades ===
+    cout << "\n=== Comparación con Branch and Bound ===\n";
+    compararEstrategias("facil1", Problema("facil1.txt"));
+    compararEstrategias("facil2", Problema("facil2.txt"));
+    compararEstrategias("med1", Problema("med1.txt"));
+    GeneradorInstancias generador(11);
+    compararEstrategias("generada clase A", generador.generar(10, 60, CLASE_A));
+    compararEstrategias("generada sin capacidad", generador.generar(10, 60, CLASE_C, 1000.0));
+
+    // === 3. A través de ResolveCFL, con la reducción del problema ===
+    Problema med("med1.txt");
+    ResolveCFL resolvedor(make_shared<StrategyBenders>(med, 100000, 1e-6));
+    ResultadoSolucion resultadoResolve = resolvedor.resolver(med);
+    cout << "\nResolveCFL med1: " << resultadoResolve.valorObjetivo << ", estrategia "
+         << resolvedor.getNombreStrategy() << " (esperado Descomposición de Benders)\n";
+
+    // === 4. Límite de tiempo ===
+    StrategyBenders strategyTiempo(med, 100000, 1e-6);
+    strategyTiempo.setLimiteTiempo(1e-9);
+    ResultadoSolucion resultadoTiempo = strategyTiempo.resolver(med);
+    cout << "Tiempo: " << ResultadoSolucion::nombreMotivo(resultadoTiempo.motivoTerminacion)
+         << " (esperado límite de tiempo u óptimo), factible? " << (resultadoTiempo.esFactible ? "Sí" : "No")
+         << " (esperado Sí)\n";
+
+    return 0;
+}
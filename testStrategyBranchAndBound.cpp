@@ -59,5 +59,35 @@ int main() {
 
     cout << "Tiempo de ejecución: " << resultado.tiempoEjecucion << " segundos\n";
 
+    // === 5. Misma instancia acotando con la relajación Lagrangeana ===
+    cout << "\n=== Cota Lagrangeana ===\n";
+    StrategyBranchAndBound strategyLagrangeana(p, 1000, 1e-6, MEJOR_PRIMERO, COTA_LAGRANGEANA);
+    ResultadoSolucion resultadoLagrangeana = strategyLagrangeana.resolver(p);
+    cout << "Valor objetivo: " << resultadoLagrangeana.valorObjetivo << " (esperado " << resultado.valorObjetivo << ")\n";
+    cout << "Iteraciones: " << resultadoLagrangeana.numIteraciones << "\n";
+
+    // === 6. Límites: med1 con un solo nodo y con un límite de memoria mínimo ===
+    cout << "\n=== Límites ===\n";
+    cout << "Sin límites: " << ResultadoSolucion::nombreMotivo(resultado.motivoTerminacion) << " (esperado óptimo), brecha "
+         << resultado.brecha << " (esperado 0)\n";
+    Problema med("med1.txt");
+    StrategyBranchAndBound strategyIteraciones(med, 1, 1e-6);
+    strategyIteraciones.setFrecuenciaBusquedaLocal(0);
+    ResultadoSolucion resultadoIteraciones = strategyIteraciones.resolver(med);
+    cout << "Un nodo: " << ResultadoSolucion::nombreMotivo(resultadoIteraciones.motivoTerminacion)
+         << " (esperado límite de iteraciones u óptimo), cota " << resultadoIteraciones.cotaInferior << " <= valor "
+         << resultadoIteraciones.valorObjetivo << ", brecha " << resultadoIteraciones.brecha << "\n";
+    StrategyBranchAndBound strategyMemoria(med, 100000, 1e-6);
+    strategyMemoria.setLimiteMemoria(1e-6);
+    ResultadoSolucion resultadoMemoria = strategyMemoria.resolver(med);
+    cout << "Memoria: " << ResultadoSolucion::nombreMotivo(resultadoMemoria.motivoTerminacion)
+         << " (esperado límite de memoria u óptimo), nodos " << resultadoMemoria.numIteraciones << " (esperado 0)\n";
+    StrategyBranchAndBound strategyTiempo(med, 100000, 1e-6);
+    strategyTiempo.setLimiteTiempo(1e-9);
+    ResultadoSolucion resultadoTiempo = strategyTiempo.resolver(med);
+    cout << "Tiempo: " << ResultadoSolucion::nombreMotivo(resultadoTiempo.motivoTerminacion)
+         << " (esperado límite de tiempo u óptimo), factible? " << (resultadoTiempo.esFactible ? "Sí" : "No")
+         << " (esperado Sí)\n";
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "StrategyBranchAndBound.h"
+#include "StrategyBranchAndBoundParalelo.h"
+#include "Problema.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main() {
+    // === 1. Cargar una instancia mediana del repositorio ===
+    string archivo = "med1.txt";
+    Problema p(archivo);
+
+    cout << "=== Test StrategyBranchAndBoundParalelo ===\n";
+    cout << "Número de clientes: " << p.getNumClientes() << "\n";
+    cout << "Número de fuentes: " << p.getNumFuentesProd() << "\n";
+
+    // === 2. Resolver en serie como referencia ===
+    StrategyBranchAndBound serial(p, 10000, 1e-6);
+    ResultadoSolucion resSerial = serial.resolver(p);
+    cout << "Serie    - Valor objetivo: " << resSerial.valorObjetivo
+         << ", Iteraciones: " << resSerial.numIteraciones
+         << ", Tiempo: " << resSerial.tiempoEjecucion << " s\n";
+
+    // === 3. Resolver en paralelo con distintos números de hilos ===
+    for (int hilos : {2, 4}) {
+        StrategyBranchAndBoundParalelo paralelo(p, 10000, 1e-6, hilos);
+        ResultadoSolucion res = paralelo.resolver(p);
+        cout << "Paralelo (" << paralelo.getNumHilos() << " hilos) - Valor objetivo: " << res.valorObjetivo
+             << ", Iteraciones: " << res.numIteraciones
+             << ", Tiempo: " << res.tiempoEjecucion << " s"
+             << ", Coincide con serie? " << (abs(res.valorObjetivo - resSerial.valorObjetivo) <= 1e-6 ? "Sí" : "No") << "\n";
+    }
+
+    return 0;
+}
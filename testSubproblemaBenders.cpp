@@ -0,0 +1,141 @@
+#include "SubproblemaBenders.h"
+#include "EvaluadorTransporte.h"
+#include "GeneradorInstancias.h"
+#include "Problema.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <random>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * Desc: Crea un archivo de prueba con datos predefinidos para cargar un problema CFL.
+ *       Contiene 2 fuentes, 3 clientes y datos de capacidades, costos y demandas.
+ * Params:
+ *   - nombreArchivo: Nombre del archivo a crear.
+ * Returns: void
+ */
+void crearArchivoPrueba(const string& nombreArchivo) {
+    ofstream archivo(nombreArchivo);
+    archivo << "2 3\n";
+    archivo << "100 200\n";
+    archivo << "10 20\n";
+    archivo << "50 60 70\n";
+    archivo << "5 6\n";
+    archivo << "7 8\n";
+    archivo << "9 10\n";
+    archivo.close();
+}
+
+/**
+ * Desc: Valor del lado derecho de un corte de optimalidad en un punto y.
+ * Params:
+ *   - corte: Corte de Benders.
+ *   - y: Apertura de cada fuente.
+ * Returns:
+ *   - double: constante + sum_j coeficientes[j] y_j.
+ */
+double valorCorte(const CorteBenders& corte, const vector<double>& y) {
+    double valor = corte.constante;
+    for (size_t j = 0; j < y.size(); j++) {
+        valor += corte.coeficientes[j] * y[j];
+    }
+    return valor;
+}
+
+/**
+ * Desc: Compara el subproblema con EvaluadorTransporte en soluciones enteras al azar y
+ *       verifica que los cortes de puntos fraccionarios no sobreestimen Q en ellas.
+ * Params:
+ *   - problema: Instancia a probar.
+ *   - semilla: Semilla de los puntos al azar.
+ * Returns:
+ *   - int: Cantidad de discrepancias encontradas.
+ */
+int compararConEvaluador(const Problema& problema, int semilla) {
+    int m = problema.getNumFuentesProd();
+    SubproblemaBenders subproblema;
+    subproblema.construir(problema);
+    EvaluadorTransporte evaluador;
+    evaluador.construir(problema);
+    mt19937 generador(semilla);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+
+    vector<CorteBenders> cortes;
+    int errores = 0;
+    for (int k = 0; k < 20; k++) {
+        vector<double> fraccionaria(m);
+        for (double& v : fraccionaria) {
+            v = uniforme(generador);
+        }
+        CorteBenders corte;
+        double q = subproblema.resolver(fraccionaria, corte);
+        if (corte.optimalidad) {
+            // El corte es exacto en el punto que lo generó
+            errores += abs(valorCorte(corte, fraccionaria) - q) > 1e-6 * (1 + abs(q));
+            cortes.push_back(corte);
+        }
+    }
+    for (int k = 0; k < 20; k++) {
+        vector<double> entera(m);
+        for (double& v : entera) {
+            v = uniforme(generador) < 0.6 ? 1.0 : 0.0;
+        }
+        CorteBenders corte;
+        double q = subproblema.resolver(entera, corte);
+        double esperado = evaluador.evaluarTransporte(entera);
+        if (esperado >= 1e20) {
+            errores += q < 1e20 || corte.optimalidad;
+            continue;
+        }
+        errores += abs(q - esperado) > 1e-6 * (1 + esperado);
+        for (const CorteBenders& anterior : cortes) {
+            errores += valorCorte(anterior, entera) > esperado + 1e-6 * (1 + esperado);
+        }
+    }
+    return errores;
+}
+
+int main() {
+    // === 1. Instancia chica con capacidades activas ===
+    string archivo = "problema_test.txt";
+    crearArchivoPrueba(archivo);
+    Problema p(archivo);
+    SubproblemaBenders subproblema;
+    subproblema.construir(p);
+    cout << "=== Test SubproblemaBenders ===\n";
+    cout << "Sin capacidad: " << subproblema.esSinCapacidad() << " (esperado 0)\n";
+    cout << "Cota de transporte: " << subproblema.getCotaTransporte() << " (esperado 1300)\n";
+
+    CorteBenders corte;
+    cout << "Q(1, 1): " << subproblema.resolver({1, 1}, corte) << " (esperado 1380)\n";
+    cout << "Corte en (1, 1): " << valorCorte(corte, {1, 1}) << " (esperado 1380)\n";
+    cout << "Corte en (0, 1): " << valorCorte(corte, {0, 1}) << " (esperado <= 1480)\n";
+    cout << "Q(0.5, 1): " << subproblema.resolver({0.5, 1}, corte) << " (esperado 1430)\n";
+    cout << "Corte en (0.5, 1): " << valorCorte(corte, {0.5, 1}) << " (esperado 1430)\n";
+    double q = subproblema.resolver({1, 0}, corte);
+    cout << "Q(1, 0): " << q << " (esperado 1e+20)\n";
+    cout << "Corte de factibilidad: " << corte.coeficientes[0] << " y0 + " << corte.coeficientes[1]
+         << " y1 >= " << corte.constante << " (esperado 100 y0 + 200 y1 >= 180)\n";
+
+    // === 2. Sin capacidades: separación por cliente ===
+    GeneradorInstancias generador(7);
+    Problema holgado = generador.generar(8, 30, CLASE_C, 1000.0);
+    SubproblemaBenders subproblemaHolgado;
+    subproblemaHolgado.construir(holgado);
+    cout << "Holgado sin capacidad: " << subproblemaHolgado.esSinCapacidad() << " (esperado 1)\n";
+    vector<double> ninguna(8, 0.0);
+    subproblemaHolgado.resolver(ninguna, corte);
+    cout << "Sin fuentes abiertas, corte de optimalidad: " << corte.optimalidad << " (esperado 0)\n";
+
+    // === 3. Contra EvaluadorTransporte, con y sin capacidades ===
+    cout << "Discrepancias holgado: " << compararConEvaluador(holgado, 1) << " (esperado 0)\n";
+    Problema ajustado = generador.generar(10, 40, CLASE_A);
+    cout << "Discrepancias ajustado: " << compararConEvaluador(ajustado, 2) << " (esperado 0)\n";
+    Problema med("med1.txt");
+    cout << "Discrepancias med1: " << compararConEvaluador(med, 3) << " (esperado 0)\n";
+
+    return 0;
+}